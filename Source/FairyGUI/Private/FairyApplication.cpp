@@ -17,13 +17,20 @@ TMap<FString, FString> UFairyApplication::Vars;
 FUIConfig UFairyApplication::UIConfig;
 FString UFairyApplication::Branch;
 
+DECLARE_CYCLE_STAT(TEXT("Event Dispatch"), STAT_FairyGUI_EventDispatch, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Events Dispatched"), STAT_FairyGUI_EventsDispatched, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Event Path Cache Hits"), STAT_FairyGUI_EventPathCacheHits, STATGROUP_FairyGUI);
+
 UFairyApplication::FTouchInfo::FTouchInfo() :
     UserIndex(0),
     PointerIndex(0),
     bDown(false),
     DownPosition(0, 0),
     bClickCancelled(false),
-    ClickCount(0)
+    bMovePending(false),
+    ClickCount(0),
+    Velocity(0, 0),
+    LastMoveTime(0)
 {
 }
 
@@ -56,6 +63,8 @@ bool UFairyApplication::FInputProcessor::HandleMouseMoveEvent(FSlateApplication&
 }
 
 UFairyApplication::UFairyApplication() :
+    CallChainDepth(0),
+    HoverPathRevision(0),
     bSoundEnabled(true),
     SoundVolumeScale(1)
 {
@@ -80,6 +89,18 @@ void UFairyApplication::CallAfterSlateTick(FSimpleDelegate Callback)
     PostTickMulticastDelegate.Add(Callback);
 }
 
+void UFairyApplication::OnSlatePreTick(float DeltaTime)
+{
+    //input of this frame has been processed, deliver the moves that were held back
+    for (auto& it : Touches)
+    {
+        if (it.bMovePending)
+            DispatchTouchMove(&it);
+    }
+
+    FRelations::SolvePending();
+}
+
 void UFairyApplication::OnSlatePostTick(float DeltaTime)
 {
     if (PostTickMulticastDelegate.IsBound())
@@ -107,6 +128,15 @@ FVector2D UFairyApplication::GetTouchPosition(int32 InUserIndex, int32 InPointer
         return FVector2D::ZeroVector;
 }
 
+FVector2D UFairyApplication::GetTouchVelocity(int32 InUserIndex, int32 InPointerIndex)
+{
+    FTouchInfo* TouchInfo = GetTouchInfo(InUserIndex, InPointerIndex);
+    if (TouchInfo != nullptr)
+        return TouchInfo->Velocity;
+    else
+        return FVector2D::ZeroVector;
+}
+
 int32 UFairyApplication::GetTouchCount() const
 {
     int32 Count = 0;
@@ -164,6 +194,8 @@ void UFairyApplication::SetSoundVolumeScale(float VolumeScale)
 
 void UFairyApplication::Initialize(FSubsystemCollectionBase& Collection)
 {
+    TweenManager = MakeUnique<FTweenManager>(GetWorld());
+
     if (!FSlateApplication::IsInitialized())
     {
         return;
@@ -172,6 +204,7 @@ void UFairyApplication::Initialize(FSubsystemCollectionBase& Collection)
     DragDropManager = NewObject<UDragDropManager>(this);
     DragDropManager->CreateAgent();
 
+    PreTickDelegateHandle = FSlateApplication::Get().OnPreTick().AddUObject(this, &UFairyApplication::OnSlatePreTick);
     PostTickDelegateHandle = FSlateApplication::Get().OnPostTick().AddUObject(this, &UFairyApplication::OnSlatePostTick);
 
     if (!InputProcessor.IsValid()) {
@@ -189,11 +222,14 @@ void UFairyApplication::Deinitialize()
 
     UNTexture::DestroyWhiteTexture();
     
-    FTweenManager::Singleton.Reset();
+    TweenManager.Reset();
 
     if (InputProcessor.IsValid())
         FSlateApplication::Get().UnregisterInputPreProcessor(InputProcessor);
 
+    if (PreTickDelegateHandle.IsValid())
+        FSlateApplication::Get().OnPreTick().Remove(PreTickDelegateHandle);
+
     if (PostTickDelegateHandle.IsValid())
         FSlateApplication::Get().OnPostTick().Remove(PostTickDelegateHandle);
     
@@ -206,6 +242,9 @@ bool UFairyApplication::DispatchEvent(const FName& EventType, const TSharedRef<S
     if (Obj == nullptr)
         return false;
 
+    SCOPE_CYCLE_COUNTER(STAT_FairyGUI_EventDispatch);
+    INC_DWORD_STAT(STAT_FairyGUI_EventsDispatched);
+
     UEventContext* Context = BorrowEventContext();
     Context->Type = EventType;
     Context->Initiator = Obj;
@@ -221,12 +260,14 @@ bool UFairyApplication::DispatchEvent(const FName& EventType, const TSharedRef<S
 
 void UFairyApplication::BubbleEvent(const FName& EventType, const TSharedRef<SWidget>& Initiator, const FNVariant& Data)
 {
-    TArray<UGObject*> CallChain;
-    SDisplayObject::GetWidgetPathToRoot(Initiator, CallChain);
-    if (CallChain.Num() == 0)
-        return;
+    SCOPE_CYCLE_COUNTER(STAT_FairyGUI_EventDispatch);
+    INC_DWORD_STAT(STAT_FairyGUI_EventsDispatched);
 
-    InternalBubbleEvent(EventType, CallChain, Data);
+    TArray<UGObject*>& CallChain = BorrowCallChain();
+    GetPathToRoot(Initiator, CallChain);
+    if (CallChain.Num() > 0)
+        InternalBubbleEvent(EventType, CallChain, Data);
+    ReturnCallChain();
 }
 
 void UFairyApplication::InternalBubbleEvent(const FName& EventType, const TArray<UGObject*>& CallChain, const FNVariant& Data)
@@ -236,10 +277,11 @@ void UFairyApplication::InternalBubbleEvent(const FName& EventType, const TArray
     Context->Initiator = CallChain[0];
     Context->Data = Data;
 
+    const int32 EventTypeIndex = UGObject::GetEventTypeIndex(EventType);
     for (auto& it : CallChain)
     {
         Context->Sender = it;
-        it->InvokeEventDelegate(Context);
+        it->InvokeEventDelegate(Context, EventTypeIndex);
 
         if (Context->bIsMouseCaptor)
         {
@@ -256,23 +298,78 @@ void UFairyApplication::InternalBubbleEvent(const FName& EventType, const TArray
 
 void UFairyApplication::BroadcastEvent(const FName& EventType, const TSharedRef<SWidget>& Initiator, const FNVariant& Data)
 {
-    TArray<UGObject*> CallChain;
+    SCOPE_CYCLE_COUNTER(STAT_FairyGUI_EventDispatch);
+    INC_DWORD_STAT(STAT_FairyGUI_EventsDispatched);
+
+    TArray<UGObject*>& CallChain = BorrowCallChain();
     SDisplayObject::GetWidgetDescendants(Initiator, CallChain);
-    if (CallChain.Num() == 0)
-        return;
+    if (CallChain.Num() > 0)
+    {
+        UEventContext* Context = BorrowEventContext();
+        Context->Type = EventType;
+        Context->Data = Data;
 
-    UEventContext* Context = BorrowEventContext();
-    Context->Type = EventType;
-    Context->Data = Data;
+        const int32 EventTypeIndex = UGObject::GetEventTypeIndex(EventType);
+        for (auto& it : CallChain)
+        {
+            Context->Sender = it;
+            Context->Initiator = it;
+            it->InvokeEventDelegate(Context, EventTypeIndex);
+        }
 
-    for (auto& it : CallChain)
+        ReturnEventContext(Context);
+    }
+    ReturnCallChain();
+}
+
+TArray<UGObject*>& UFairyApplication::BorrowCallChain()
+{
+    //listeners may dispatch further events, so every nesting level gets its own buffer
+    if (CallChainDepth == CallChainStack.Num())
+        CallChainStack.Add(new TArray<UGObject*>());
+
+    return CallChainStack[CallChainDepth++];
+}
+
+void UFairyApplication::ReturnCallChain()
+{
+    check(CallChainDepth > 0);
+    CallChainStack[--CallChainDepth].Reset();
+}
+
+void UFairyApplication::GetPathToRoot(const TSharedRef<SWidget>& Initiator, TArray<UGObject*>& OutCallChain)
+{
+    //the pointer keeps hitting the same widget, reuse its path until the hierarchy changes
+    if (HoverPathRevision == SDisplayObject::HierarchyRevision && HoverPathWidget.Pin() == Initiator)
     {
-        Context->Sender = it;
-        Context->Initiator = it;
-        it->InvokeEventDelegate(Context);
+        bool bValid = true;
+        for (auto& it : HoverPath)
+        {
+            UGObject* Obj = it.Get();
+            if (Obj == nullptr)
+            {
+                bValid = false;
+                break;
+            }
+            OutCallChain.Add(Obj);
+        }
+
+        if (bValid)
+        {
+            INC_DWORD_STAT(STAT_FairyGUI_EventPathCacheHits);
+            return;
+        }
+
+        OutCallChain.Reset();
     }
 
-    ReturnEventContext(Context);
+    SDisplayObject::GetWidgetPathToRoot(Initiator, OutCallChain);
+
+    HoverPathWidget = Initiator;
+    HoverPathRevision = SDisplayObject::HierarchyRevision;
+    HoverPath.Reset();
+    for (auto& it : OutCallChain)
+        HoverPath.Add(it);
 }
 
 UEventContext* UFairyApplication::BorrowEventContext()
@@ -369,7 +466,10 @@ void UFairyApplication::PreviewDownEvent(const FPointerEvent& MouseEvent)
     TouchInfo->bDown = true;
     TouchInfo->DownPosition = MouseEvent.GetScreenSpacePosition();
     TouchInfo->bClickCancelled = false;
+    TouchInfo->bMovePending = false;
     TouchInfo->ClickCount = 1;
+    TouchInfo->Velocity.Set(0, 0);
+    TouchInfo->LastMoveTime = FPlatformTime::Seconds();
     TouchInfo->MouseCaptors.Reset();
     TouchInfo->bToClearCaptors = false;
     TouchInfo->DownPath.Reset();
@@ -380,6 +480,9 @@ void UFairyApplication::PreviewDownEvent(const FPointerEvent& MouseEvent)
 void UFairyApplication::PreviewUpEvent(const FPointerEvent& MouseEvent)
 {
     FTouchInfo* TouchInfo = GetTouchInfo(MouseEvent);
+    if (TouchInfo->bMovePending)
+        DispatchTouchMove(TouchInfo);
+
     TouchInfo->Event = MouseEvent;
     TouchInfo->bDown = false;
     TouchInfo->bToClearCaptors = true;
@@ -403,13 +506,36 @@ void UFairyApplication::PreviewUpEvent(const FPointerEvent& MouseEvent)
 void UFairyApplication::PreviewMoveEvent(const FPointerEvent& MouseEvent)
 {
     FTouchInfo* TouchInfo = GetTouchInfo(MouseEvent);
+
+    //smoothed over about 50ms of raw samples, independent of how many moves are dispatched
+    const double Now = FPlatformTime::Seconds();
+    const float Elapsed = (float)(Now - TouchInfo->LastMoveTime);
+    if (Elapsed > 0 && TouchInfo->LastMoveTime > 0)
+    {
+        FVector2D Sample = (MouseEvent.GetScreenSpacePosition() - TouchInfo->Event.GetScreenSpacePosition()) / Elapsed;
+        TouchInfo->Velocity = FMath::Lerp(TouchInfo->Velocity, Sample, 1 - FMath::Exp(-Elapsed / 0.05f));
+    }
+    TouchInfo->LastMoveTime = Now;
     TouchInfo->Event = MouseEvent;
 
     if ((TouchInfo->DownPosition - MouseEvent.GetScreenSpacePosition()).GetAbsMax() > 50)
         TouchInfo->bClickCancelled = true;
 
+    if (UIConfig.CoalescePointerMoves)
+        TouchInfo->bMovePending = true;
+    else
+        DispatchTouchMove(TouchInfo);
+}
+
+void UFairyApplication::DispatchTouchMove(FTouchInfo* TouchInfo)
+{
+    TouchInfo->bMovePending = false;
+
     if (!TouchInfo->bToClearCaptors && TouchInfo->MouseCaptors.Num() > 0)
     {
+        //event contexts read the pointer event from the last touch
+        LastTouch = TouchInfo;
+
         // FMyScopedSwitchWorldHack SwitchWorld(GetWorld());
 
         int32 cnt = TouchInfo->MouseCaptors.Num();
@@ -462,8 +588,8 @@ FReply UFairyApplication::OnWidgetMouseButtonUp(const TSharedRef<SWidget>& Widge
     if (TouchInfo == nullptr)
         return FReply::Handled().ReleaseMouseCapture();
 
-    TArray<UGObject*> CallChain;
-    SDisplayObject::GetWidgetPathToRoot(Widget, CallChain);
+    TArray<UGObject*>& CallChain = BorrowCallChain();
+    GetPathToRoot(Widget, CallChain);
     if (CallChain.Num() > 0)
     {
         for (auto& it : TouchInfo->MouseCaptors)
@@ -475,6 +601,7 @@ FReply UFairyApplication::OnWidgetMouseButtonUp(const TSharedRef<SWidget>& Widge
         if (CallChain.Num() > 0)
             InternalBubbleEvent(FUIEvents::TouchEnd, CallChain, FNVariant::Null);
     }
+    ReturnCallChain();
     TouchInfo->MouseCaptors.Reset();
 
     if (!TouchInfo->bClickCancelled)
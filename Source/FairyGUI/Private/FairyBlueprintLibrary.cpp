@@ -80,7 +80,7 @@ FTweenerHandle UFairyBlueprintLibrary::TweenFloat(float StartValue, float EndVal
     if (Target == nullptr)
         return FTweenerHandle();
 
-    FGTweener* Tweener = FGTween::To(StartValue, EndValue, Duration)
+    FGTweener* Tweener = FGTween::To(StartValue, EndValue, Duration, Target)
         ->SetEase(EaseType)
         ->SetRepeat(Repeat)
         ->SetTarget(const_cast<UObject*>(Target));
@@ -112,7 +112,7 @@ FTweenerHandle UFairyBlueprintLibrary::TweenVector2(const FVector2D& StartValue,
     if (Target == nullptr)
         return FTweenerHandle();
 
-    FGTweener* Tweener = FGTween::To(StartValue, EndValue, Duration)
+    FGTweener* Tweener = FGTween::To(StartValue, EndValue, Duration, Target)
         ->SetEase(EaseType)
         ->SetRepeat(Repeat)
         ->SetTarget(const_cast<UObject*>(Target));
@@ -6,6 +6,8 @@
 #include "FairyApplication.h"
 #endif
 #include "UI/UIConfig.h"
+#include "Widgets/TextLayoutCache.h"
+#include "Widgets/GlyphCache.h"
 
 #define LOCTEXT_NAMESPACE "FFairyGUIModule"
 
@@ -15,6 +17,8 @@ void FFairyGUIModule::StartupModule()
 
 void FFairyGUIModule::ShutdownModule()
 {
+    FTextLayoutCache::Get().Empty();
+    FGlyphCache::Empty();
 }
 
 #undef LOCTEXT_NAMESPACE
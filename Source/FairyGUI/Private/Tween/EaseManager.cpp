@@ -11,6 +11,85 @@ public:
     static float EaseInOut(float Time, float Duration);
 };
 
+//x^Power for the polynomial ease types
+template<int32 Power>
+static FORCEINLINE VectorRegister4Float VectorPow(const VectorRegister4Float& X)
+{
+    VectorRegister4Float Result = X;
+    for (int32 i = 1; i < Power; i++)
+        Result = VectorMultiply(Result, X);
+    return Result;
+}
+
+template<int32 Power>
+static FORCEINLINE VectorRegister4Float PolyEaseIn(const VectorRegister4Float& X)
+{
+    return VectorPow<Power>(X);
+}
+
+template<int32 Power>
+static FORCEINLINE VectorRegister4Float PolyEaseOut(const VectorRegister4Float& X)
+{
+    //odd powers: (x-1)^n + 1, even powers: 1 - (x-1)^n
+    const VectorRegister4Float P = VectorPow<Power>(VectorSubtract(X, VectorOne()));
+    return (Power & 1) ? VectorAdd(P, VectorOne()) : VectorSubtract(VectorOne(), P);
+}
+
+template<int32 Power>
+static FORCEINLINE VectorRegister4Float PolyEaseInOut(const VectorRegister4Float& X)
+{
+    const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+    const VectorRegister4Float Two = VectorSetFloat1(2.0f);
+    const VectorRegister4Float T = VectorMultiply(X, Two);
+    const VectorRegister4Float In = VectorMultiply(Half, VectorPow<Power>(T));
+    const VectorRegister4Float P = VectorPow<Power>(VectorSubtract(T, Two));
+    const VectorRegister4Float Out = (Power & 1) ? VectorMultiplyAdd(Half, P, VectorOne()) : VectorSubtract(VectorOne(), VectorMultiply(Half, P));
+    return VectorSelect(VectorCompareLT(T, VectorOne()), In, Out);
+}
+
+template<VectorRegister4Float(*Kernel)(const VectorRegister4Float&)>
+static void EvaluateVectorized(const float* Time, const float* Duration, float* OutRatio, int32 Count)
+{
+    for (int32 i = 0; i < Count; i += 4)
+    {
+        const VectorRegister4Float X = VectorDivide(VectorLoad(Time + i), VectorLoad(Duration + i));
+        VectorStore(Kernel(X), OutRatio + i);
+    }
+}
+
+static FORCEINLINE VectorRegister4Float LinearEase(const VectorRegister4Float& X)
+{
+    return X;
+}
+
+void EaseManager::EvaluateBatch(EEaseType EaseType, const float* Time, const float* Duration, const float* OvershootOrAmplitude, const float* Period,
+    float* OutRatio, int32 Count)
+{
+    check((Count & 3) == 0);
+
+    switch (EaseType)
+    {
+    case EEaseType::Linear: EvaluateVectorized<LinearEase>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuadIn: EvaluateVectorized<PolyEaseIn<2>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuadOut: EvaluateVectorized<PolyEaseOut<2>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuadInOut: EvaluateVectorized<PolyEaseInOut<2>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::CubicIn: EvaluateVectorized<PolyEaseIn<3>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::CubicOut: EvaluateVectorized<PolyEaseOut<3>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::CubicInOut: EvaluateVectorized<PolyEaseInOut<3>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuartIn: EvaluateVectorized<PolyEaseIn<4>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuartOut: EvaluateVectorized<PolyEaseOut<4>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuartInOut: EvaluateVectorized<PolyEaseInOut<4>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuintIn: EvaluateVectorized<PolyEaseIn<5>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuintOut: EvaluateVectorized<PolyEaseOut<5>>(Time, Duration, OutRatio, Count); break;
+    case EEaseType::QuintInOut: EvaluateVectorized<PolyEaseInOut<5>>(Time, Duration, OutRatio, Count); break;
+
+    default:
+        for (int32 i = 0; i < Count; i++)
+            OutRatio[i] = Evaluate(EaseType, Time[i], Duration[i], OvershootOrAmplitude[i], Period[i]);
+        break;
+    }
+}
+
 float EaseManager::Evaluate(EEaseType EaseType, float Time, float Duration, float OvershootOrAmplitude, float Period)
 {
     switch (EaseType)
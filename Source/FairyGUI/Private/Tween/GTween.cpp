@@ -2,74 +2,87 @@
 #include "Tween/TweenManager.h"
 #include "UI/GProgressBar.h"
 
-FGTweener* FGTween::To(float StartValue, float EndValue, float Duration)
+FGTweener* FGTween::To(float StartValue, float EndValue, float Duration, const UObject* WorldContext)
 {
-    return FTweenManager::Singleton.CreateTween()->To(StartValue, EndValue, Duration);
+    return FTweenManager::Get(WorldContext).CreateTween()->To(StartValue, EndValue, Duration);
 }
 
-FGTweener* FGTween::To(const FVector2D& StartValue, const FVector2D & EndValue, float Duration)
+FGTweener* FGTween::To(const FVector2D& StartValue, const FVector2D & EndValue, float Duration, const UObject* WorldContext)
 {
-    return FTweenManager::Singleton.CreateTween()->To(StartValue, EndValue, Duration);
+    return FTweenManager::Get(WorldContext).CreateTween()->To(StartValue, EndValue, Duration);
 }
 
-FGTweener* FGTween::To(const FVector& StartValue, const FVector & EndValue, float Duration)
+FGTweener* FGTween::To(const FVector& StartValue, const FVector & EndValue, float Duration, const UObject* WorldContext)
 {
-    return FTweenManager::Singleton.CreateTween()->To(StartValue, EndValue, Duration);
+    return FTweenManager::Get(WorldContext).CreateTween()->To(StartValue, EndValue, Duration);
 }
 
-FGTweener* FGTween::To(const FVector4& StartValue, const FVector4 & EndValue, float Duration)
+FGTweener* FGTween::To(const FVector4& StartValue, const FVector4 & EndValue, float Duration, const UObject* WorldContext)
 {
-    return FTweenManager::Singleton.CreateTween()->To(StartValue, EndValue, Duration);
+    return FTweenManager::Get(WorldContext).CreateTween()->To(StartValue, EndValue, Duration);
 }
 
-FGTweener* FGTween::To(const FColor& StartValue, const FColor & EndValue, float Duration)
+FGTweener* FGTween::To(const FColor& StartValue, const FColor & EndValue, float Duration, const UObject* WorldContext)
 {
-    return FTweenManager::Singleton.CreateTween()->To(StartValue, EndValue, Duration);
+    return FTweenManager::Get(WorldContext).CreateTween()->To(StartValue, EndValue, Duration);
 }
 
-FGTweener* FGTween::ToDouble(double StartValue, double EndValue, float Duration)
+FGTweener* FGTween::ToDouble(double StartValue, double EndValue, float Duration, const UObject* WorldContext)
 {
-    return FTweenManager::Singleton.CreateTween()->To(StartValue, EndValue, Duration);
+    return FTweenManager::Get(WorldContext).CreateTween()->To(StartValue, EndValue, Duration);
 }
 
-FGTweener* FGTween::DelayedCall(float Delay)
+FGTweener* FGTween::DelayedCall(float Delay, const UObject* WorldContext)
 {
-    return FTweenManager::Singleton.CreateTween()->SetDelay(Delay);
+    return FTweenManager::Get(WorldContext).CreateTween()->SetDelay(Delay);
 }
 
-FGTweener* FGTween::Shake(const FVector2D& StartValue, float Amplitude, float Duration)
+FGTweener* FGTween::Shake(const FVector2D& StartValue, float Amplitude, float Duration, const UObject* WorldContext)
 {
-    return FTweenManager::Singleton.CreateTween()->Shake(StartValue, Amplitude, Duration);
+    return FTweenManager::Get(WorldContext).CreateTween()->Shake(StartValue, Amplitude, Duration);
 }
 
 bool FGTween::IsTweening(const FTweenerHandle& Handle)
 {
-    return FTweenManager::Singleton.IsTweening(Handle);
+    return GetTween(Handle) != nullptr;
 }
 
 bool FGTween::IsTweening(UObject* Target)
 {
-    return FTweenManager::Singleton.IsTweening(Target);
+    return GetTween(Target) != nullptr;
 }
 
 void FGTween::Kill(FTweenerHandle& Handle, bool bSetComplete)
 {
-    FTweenManager::Singleton.KillTween(Handle, bSetComplete);
+    FTweenManager* Manager = FTweenManager::Get(Handle);
+    if (Manager != nullptr)
+        Manager->KillTween(Handle, bSetComplete);
+    else
+        Handle.Invalidate();
 }
 
 void FGTween::Kill(UObject* Target, bool bSetComplete)
 {
-    FTweenManager::Singleton.KillTweens(Target, bSetComplete);
+    FTweenManager& Manager = FTweenManager::Get(Target);
+    Manager.KillTweens(Target, bSetComplete);
+    if (&Manager != &FTweenManager::GetDefault())
+        FTweenManager::GetDefault().KillTweens(Target, bSetComplete);
 }
 
 FGTweener* FGTween::GetTween(const FTweenerHandle& Handle)
 {
-    return FTweenManager::Singleton.GetTween(Handle);
+    FTweenManager* Manager = FTweenManager::Get(Handle);
+    return Manager != nullptr ? Manager->GetTween(Handle) : nullptr;
 }
 
 FGTweener* FGTween::GetTween(UObject * Target)
 {
-    return FTweenManager::Singleton.GetTween(Target);
+    //a tween created without a world context may still target an object of a world
+    FTweenManager& Manager = FTweenManager::Get(Target);
+    FGTweener* Tweener = Manager.GetTween(Target);
+    if (Tweener == nullptr && &Manager != &FTweenManager::GetDefault())
+        Tweener = FTweenManager::GetDefault().GetTween(Target);
+    return Tweener;
 }
 
 void FGTweenAction::MoveX(FGTweener* Tweener)
@@ -1,9 +1,14 @@
 #include "Tween/GTweener.h"
 #include "Tween/EaseManager.h"
 #include "Tween/GPath.h"
+#include "Tween/TweenManager.h"
 #include "UI/GObject.h"
 
-FGTweener::FGTweener()
+FGTweener::FGTweener() :
+    Manager(nullptr),
+    IndexedTarget(nullptr),
+    TickGroup(ETweenTickGroup::UI),
+    PendingTime(0)
 {
 }
 
@@ -68,10 +73,17 @@ FGTweener* FGTweener::SetSnapping(bool bInValue)
 
 FGTweener* FGTweener::SetTarget(UObject* InTarget)
 {
+    Manager->AddToTargetIndex(this, InTarget);
     Target = InTarget;
     return this;
 }
 
+FGTweener* FGTweener::SetTickGroup(ETweenTickGroup InValue)
+{
+    TickGroup = InValue;
+    return this;
+}
+
 FGTweener* FGTweener::SetUserData(const FNVariant& InData)
 {
     UserData = InData;
@@ -171,6 +183,7 @@ void FGTweener::Kill(bool bSetComplete)
     }
 
     bKilled = true;
+    Manager->RemoveFromTargetIndex(this);
 }
 
 FGTweener* FGTweener::To(float InStart, float InEnd, float InDuration)
@@ -259,6 +272,8 @@ void FGTweener::Init()
     bStarted = false;
     bPaused = false;
     bKilled = false;
+    TickGroup = ETweenTickGroup::UI;
+    PendingTime = 0;
     ElapsedTime = 0;
     NormalizedTime = 0;
     Ended = 0;
@@ -294,18 +309,49 @@ void FGTweener::Update(float DeltaTime)
 
     ElapsedTime += DeltaTime;
     Update();
+    FinishUpdate();
+}
 
-    if (Ended != 0)
+void FGTweener::Update()
+{
+    float tt;
+    if (!UpdateTime(tt))
+        return;
+
+    NormalizedTime = EaseManager::Evaluate(EaseType, tt, Duration, EaseOvershootOrAmplitude, EasePeriod);
+    UpdateValue(nullptr);
+}
+
+bool FGTweener::CanBatchUpdate() const
+{
+    return ValueSize >= 1 && ValueSize <= 4 && !Path.IsValid() && Duration > 0 && Ended == 0;
+}
+
+bool FGTweener::BeginBatchUpdate(float DeltaTime, float& OutEaseTime)
+{
+    if (TimeScale != 1)
+        DeltaTime *= TimeScale;
+    if (DeltaTime == 0)
+        return false;
+
+    ElapsedTime += DeltaTime;
+    if (!UpdateTime(OutEaseTime))
     {
-        if (!bKilled)
-        {
-            OnCompleteCallback.ExecuteIfBound(this);
-            bKilled = true;
-        }
+        FinishUpdate();
+        return false;
     }
+
+    return true;
 }
 
-void FGTweener::Update()
+void FGTweener::EndBatchUpdate(float InNormalizedTime, const float* InValues)
+{
+    NormalizedTime = InNormalizedTime;
+    UpdateValue(InValues);
+    FinishUpdate();
+}
+
+bool FGTweener::UpdateTime(float& OutEaseTime)
 {
     Ended = 0;
 
@@ -314,18 +360,18 @@ void FGTweener::Update()
         if (ElapsedTime >= Delay + Duration)
             Ended = 1;
 
-        return;
+        return false;
     }
 
     if (!bStarted)
     {
         if (ElapsedTime < Delay)
-            return;
+            return false;
 
         bStarted = true;
         OnStartCallback.ExecuteIfBound(this);
         if (bKilled)
-            return;
+            return false;
     }
 
     bool reversed = false;
@@ -357,9 +403,12 @@ void FGTweener::Update()
         Ended = 1;
     }
 
-    NormalizedTime = EaseManager::Evaluate(EaseType, reversed ? (Duration - tt) : tt, Duration,
-        EaseOvershootOrAmplitude, EasePeriod);
+    OutEaseTime = reversed ? (Duration - tt) : tt;
+    return true;
+}
 
+void FGTweener::UpdateValue(const float* InValues)
+{
     Value.Reset();
     DeltaValue.Reset();
 
@@ -406,9 +455,15 @@ void FGTweener::Update()
     {
         for (int32 i = 0; i < ValueSize; i++)
         {
-            float n1 = StartValue[i];
-            float n2 = EndValue[i];
-            float f = n1 + (n2 - n1) * NormalizedTime;
+            float f;
+            if (InValues != nullptr) //interpolated by the batch
+                f = InValues[i];
+            else
+            {
+                float n1 = StartValue[i];
+                float n2 = EndValue[i];
+                f = n1 + (n2 - n1) * NormalizedTime;
+            }
             if (bSnapping)
                 f = FMath::RoundToFloat(f);
             DeltaValue[i] = f - Value[i];
@@ -418,4 +473,16 @@ void FGTweener::Update()
     }
 
     OnUpdateCallback.ExecuteIfBound(this);
+}
+
+void FGTweener::FinishUpdate()
+{
+    if (Ended != 0)
+    {
+        if (!bKilled)
+        {
+            OnCompleteCallback.ExecuteIfBound(this);
+            bKilled = true;
+        }
+    }
 }
\ No newline at end of file
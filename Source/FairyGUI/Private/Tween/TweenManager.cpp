@@ -1,19 +1,77 @@
 #include "Tween/TweenManager.h"
 #include "Tween/GTweener.h"
+#include "Tween/EaseManager.h"
+#include "FairyCommons.h"
+#include "FairyApplication.h"
 
-FTweenManager FTweenManager::Singleton;
+DECLARE_CYCLE_STAT(TEXT("Tween Evaluate"), STAT_FairyGUI_TweenEvaluate, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tweens Batched"), STAT_FairyGUI_TweensBatched, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tweens Unbatched"), STAT_FairyGUI_TweensUnbatched, STATGROUP_FairyGUI);
 
-FTweenManager::FTweenManager()
+FTweenManager* FTweenManager::Managers[FTweenerHandle::MaxManagerId];
+FTweenManager* FTweenManager::TickingManager = nullptr;
+FTweenManager FTweenManager::DefaultManager;
+
+FTweenManager& FTweenManager::Get(const UObject* WorldContext)
+{
+    if (WorldContext != nullptr && GEngine != nullptr)
+    {
+        UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
+        UFairyApplication* App = World != nullptr ? World->GetSubsystem<UFairyApplication>() : nullptr;
+        if (App != nullptr && App->GetTweenManager() != nullptr)
+            return *App->GetTweenManager();
+    }
+
+    if (TickingManager != nullptr)
+        return *TickingManager;
+    else
+        return DefaultManager;
+}
+
+FTweenManager* FTweenManager::Get(const FTweenerHandle& Handle)
+{
+    if (!Handle.IsValid())
+        return nullptr;
+
+    return Managers[Handle.GetManagerId()];
+}
+
+FTweenManager::FTweenManager(UWorld* InWorld) :
+    World(InWorld),
+    ManagerId(INDEX_NONE),
+    BackgroundCursor(0),
+    LastTickTime(0)
 {
     TotalActiveTweens = 0;
+    TweenerInstanceCount = 0;
     ArrayLength = 30;
     ActiveTweens = new FGTweener*[ArrayLength];
+    FMemory::Memzero(GroupTweenCount);
+
+    //ids are handed out round robin, so a handle of a destroyed manager is unlikely to resolve to a new one
+    static int32 NextManagerId = 0;
+    for (int32 i = 0; i < FTweenerHandle::MaxManagerId; i++)
+    {
+        int32 id = (NextManagerId + i) % FTweenerHandle::MaxManagerId;
+        if (Managers[id] == nullptr)
+        {
+            ManagerId = id;
+            Managers[id] = this;
+            NextManagerId = id + 1;
+            break;
+        }
+    }
+    checkf(ManagerId != INDEX_NONE, TEXT("Too many tween managers"));
 }
 
 FTweenManager::~FTweenManager()
 {
     Reset();
     delete []ActiveTweens;
+
+    Managers[ManagerId] = nullptr;
+    if (TickingManager == this)
+        TickingManager = nullptr;
 }
 
 void FTweenManager::Reset()
@@ -30,6 +88,13 @@ void FTweenManager::Reset()
             delete tweener;
     }
     TotalActiveTweens = 0;
+
+    HandleSlots.Reset();
+    TargetTweens.Reset();
+
+    for (FTweenBucket* bucket : ActiveBuckets)
+        bucket->Reset(4);
+    ActiveBuckets.Reset();
 }
 
 FGTweener* FTweenManager::CreateTween()
@@ -49,7 +114,11 @@ FGTweener* FTweenManager::CreateTween()
             TweenerInstanceCount = 0;
         }
         tweener = new FGTweener();
-        tweener->Handle.SetIndex(TweenerInstanceCount);
+        tweener->Manager = this;
+        tweener->Handle.SetIndex(TweenerInstanceCount, ManagerId);
+        if (HandleSlots.Num() <= (int32)TweenerInstanceCount)
+            HandleSlots.SetNumZeroed(TweenerInstanceCount + 1);
+        HandleSlots[TweenerInstanceCount] = tweener;
     }
     tweener->Init();
     ActiveTweens[TotalActiveTweens++] = tweener;
@@ -69,20 +138,13 @@ FGTweener* FTweenManager::CreateTween()
 
 bool FTweenManager::KillTween(FTweenerHandle & Handle, bool bCompleted)
 {
-    int32 cnt = TotalActiveTweens;
-    for (int32 i = 0; i < cnt; i++)
-    {
-        FGTweener* tweener = ActiveTweens[i];
-        if (tweener != nullptr && tweener->Handle == Handle && !tweener->bKilled)
-        {
-            Handle.Invalidate();
-            tweener->Kill(bCompleted);
-            return true;
-        }
-    }
-
+    FGTweener* tweener = GetTween(Handle);
     Handle.Invalidate();
-    return false;
+    if (tweener == nullptr)
+        return false;
+
+    tweener->Kill(bCompleted);
+    return true;
 }
 
 bool FTweenManager::KillTweens(UObject* Target, bool bCompleted)
@@ -90,12 +152,14 @@ bool FTweenManager::KillTweens(UObject* Target, bool bCompleted)
     if (Target == nullptr)
         return false;
 
+    //killing may run complete callbacks which create or kill tweens, so don't iterate the index directly
+    TArray<FGTweener*, TInlineAllocator<8>> tweeners;
+    TargetTweens.MultiFind(Target, tweeners);
+
     bool flag = false;
-    int32 cnt = TotalActiveTweens;
-    for (int32 i = 0; i < cnt; i++)
+    for (FGTweener* tweener : tweeners)
     {
-        FGTweener* tweener = ActiveTweens[i];
-        if (tweener != nullptr && tweener->Target.Get() == Target && !tweener->bKilled)
+        if (tweener->Target.Get() == Target && !tweener->bKilled)
         {
             tweener->Kill(bCompleted);
             flag = true;
@@ -110,17 +174,15 @@ FGTweener* FTweenManager::GetTween(FTweenerHandle const& Handle)
     if (!Handle.IsValid())
         return nullptr;
 
-    int32 cnt = TotalActiveTweens;
-    for (int32 i = 0; i < cnt; i++)
-    {
-        FGTweener* tweener = ActiveTweens[i];
-        if (tweener != nullptr && tweener->Handle == Handle && !tweener->bKilled)
-        {
-            return tweener;
-        }
-    }
+    int32 index = Handle.GetIndex();
+    if (Handle.GetManagerId() != ManagerId || index >= HandleSlots.Num())
+        return nullptr;
 
-    return nullptr;
+    FGTweener* tweener = HandleSlots[index];
+    if (tweener != nullptr && tweener->Handle == Handle && !tweener->bKilled)
+        return tweener;
+    else
+        return nullptr;
 }
 
 FGTweener* FTweenManager::GetTween(UObject* Target)
@@ -128,21 +190,51 @@ FGTweener* FTweenManager::GetTween(UObject* Target)
     if (Target == nullptr)
         return nullptr;
 
-    int32 cnt = TotalActiveTweens;
-    for (int32 i = 0; i < cnt; i++)
+    for (auto it = TargetTweens.CreateConstKeyIterator(Target); it; ++it)
     {
-        FGTweener* tweener = ActiveTweens[i];
-        if (tweener != nullptr && tweener->Target.Get() == Target && !tweener->bKilled)
-        {
+        FGTweener* tweener = it.Value();
+        if (tweener->Target.Get() == Target && !tweener->bKilled)
             return tweener;
-        }
     }
 
     return nullptr;
 }
 
+void FTweenManager::AddToTargetIndex(FGTweener* Tweener, UObject* Target)
+{
+    if (Tweener->IndexedTarget == Target)
+        return;
+
+    RemoveFromTargetIndex(Tweener);
+    if (Target != nullptr)
+    {
+        TargetTweens.Add(Target, Tweener);
+        Tweener->IndexedTarget = Target;
+    }
+}
+
+void FTweenManager::RemoveFromTargetIndex(FGTweener* Tweener)
+{
+    if (Tweener->IndexedTarget == nullptr)
+        return;
+
+    TargetTweens.RemoveSingle(Tweener->IndexedTarget, Tweener);
+    Tweener->IndexedTarget = nullptr;
+}
+
 void FTweenManager::Tick(float DeltaTime)
 {
+    double startTime = FPlatformTime::Seconds();
+    FTweenManager* prevTickingManager = TickingManager;
+    TickingManager = this;
+
+    bool bWorldPaused = World.IsValid() && World->IsPaused();
+    const FUIConfig& config = UFairyApplication::GetUIConfig();
+    float backgroundInterval = config.TweenBackgroundTickRate > 0 ? 1 / config.TweenBackgroundTickRate : 0;
+    //a tween that waited for the budget catches up at most this much time in one step, the rest stays pending
+    float maxStepTime = FMath::Max(backgroundInterval, DeltaTime) * MaxBackgroundCatchUpSteps;
+    FMemory::Memzero(GroupTweenCount);
+
     int32 cnt = TotalActiveTweens;
     int32 freePosStart = -1;
     for (int32 i = 0; i < cnt; i++)
@@ -155,6 +247,7 @@ void FTweenManager::Tick(float DeltaTime)
         }
         else if (tweener->bKilled)
         {
+            RemoveFromTargetIndex(tweener);
             tweener->Reset();
             TweenerPool.Add(tweener);
             ActiveTweens[i] = nullptr;
@@ -164,10 +257,29 @@ void FTweenManager::Tick(float DeltaTime)
         }
         else
         {
+            GroupTweenCount[(int32)tweener->TickGroup]++;
+
             if (tweener->Target.IsStale())
                 tweener->bKilled = true;
             else if (!tweener->bPaused)
-                tweener->Update(DeltaTime);
+            {
+                switch (tweener->TickGroup)
+                {
+                case ETweenTickGroup::Gameplay:
+                    if (!bWorldPaused)
+                        UpdateTweener(tweener, DeltaTime);
+                    break;
+
+                case ETweenTickGroup::Background:
+                    //updated by UpdateBackgroundTweens once the array is compacted
+                    tweener->PendingTime += DeltaTime;
+                    break;
+
+                default:
+                    UpdateTweener(tweener, DeltaTime);
+                    break;
+                }
+            }
 
             if (freePosStart != -1)
             {
@@ -189,4 +301,167 @@ void FTweenManager::Tick(float DeltaTime)
         }
         TotalActiveTweens = freePosStart;
     }
+
+    if (GroupTweenCount[(int32)ETweenTickGroup::Background] > 0)
+        UpdateBackgroundTweens(backgroundInterval, maxStepTime, config.TweenBackgroundFrameBudget);
+
+    UpdateBatch();
+
+    TickingManager = prevTickingManager;
+    LastTickTime = FPlatformTime::Seconds() - startTime;
+}
+
+void FTweenManager::UpdateBackgroundTweens(float Interval, float MaxStepTime, float Budget)
+{
+    //round robin from where the budget ran out last frame, so tweens late in the array are not starved
+    int32 cnt = TotalActiveTweens;
+    if (BackgroundCursor >= cnt)
+        BackgroundCursor = 0;
+
+    double deadline = 0;
+    for (int32 k = 0; k < cnt; k++)
+    {
+        int32 i = (BackgroundCursor + k) % cnt;
+        FGTweener* tweener = ActiveTweens[i];
+        if (tweener == nullptr || tweener->bKilled || tweener->bPaused
+            || tweener->TickGroup != ETweenTickGroup::Background || tweener->PendingTime < Interval)
+            continue;
+
+        //the budget counts from the first Background update, not from the start of the tick
+        double now = FPlatformTime::Seconds();
+        if (deadline == 0)
+            deadline = now + Budget;
+        else if (now >= deadline)
+        {
+            BackgroundCursor = i;
+            return;
+        }
+
+        float stepTime = FMath::Min(tweener->PendingTime, MaxStepTime);
+        tweener->PendingTime -= stepTime;
+        UpdateTweener(tweener, stepTime);
+    }
+}
+
+void FTweenManager::UpdateTweener(FGTweener* Tweener, float DeltaTime)
+{
+    float easeTime;
+    if (!Tweener->CanBatchUpdate())
+    {
+        INC_DWORD_STAT(STAT_FairyGUI_TweensUnbatched);
+        Tweener->Update(DeltaTime);
+    }
+    else if (Tweener->BeginBatchUpdate(DeltaTime, easeTime))
+        AddToBatch(Tweener, easeTime);
+}
+
+void FTweenManager::FTweenBucket::Reset(int32 ValueSize)
+{
+    Tweeners.Reset();
+    Time.Reset();
+    Duration.Reset();
+    OvershootOrAmplitude.Reset();
+    Period.Reset();
+    Ratio.Reset();
+    for (int32 i = 0; i < ValueSize; i++)
+    {
+        Start[i].Reset();
+        End[i].Reset();
+        Output[i].Reset();
+    }
+}
+
+void FTweenManager::FTweenBucket::Pad(int32 ValueSize)
+{
+    //the kernels work on four lanes at a time
+    int32 cnt = Align(Tweeners.Num(), 4);
+    Time.SetNumZeroed(cnt);
+    Duration.Reserve(cnt);
+    while (Duration.Num() < cnt)
+        Duration.Add(1);
+    OvershootOrAmplitude.SetNumZeroed(cnt);
+    Period.SetNumZeroed(cnt);
+    Ratio.SetNumUninitialized(cnt);
+    for (int32 i = 0; i < ValueSize; i++)
+    {
+        Start[i].SetNumZeroed(cnt);
+        End[i].SetNumZeroed(cnt);
+        Output[i].SetNumUninitialized(cnt);
+    }
+}
+
+void FTweenManager::AddToBatch(FGTweener* Tweener, float EaseTime)
+{
+    FTweenBucket& bucket = Buckets[(int32)Tweener->EaseType][Tweener->ValueSize - 1];
+    if (bucket.Tweeners.Num() == 0)
+        ActiveBuckets.Add(&bucket);
+
+    bucket.Tweeners.Add(Tweener);
+    bucket.Time.Add(EaseTime);
+    bucket.Duration.Add(Tweener->Duration);
+    bucket.OvershootOrAmplitude.Add(Tweener->EaseOvershootOrAmplitude);
+    bucket.Period.Add(Tweener->EasePeriod);
+    for (int32 i = 0; i < Tweener->ValueSize; i++)
+    {
+        bucket.Start[i].Add(Tweener->StartValue[i]);
+        bucket.End[i].Add(Tweener->EndValue[i]);
+    }
+}
+
+void FTweenManager::UpdateBatch()
+{
+    if (ActiveBuckets.Num() == 0)
+        return;
+
+    //first pass: easing and interpolation, no user code runs here
+    {
+        SCOPE_CYCLE_COUNTER(STAT_FairyGUI_TweenEvaluate);
+
+        for (FTweenBucket* bucket : ActiveBuckets)
+        {
+            int32 valueSize = bucket->Tweeners[0]->ValueSize;
+            bucket->Pad(valueSize);
+            int32 cnt = bucket->Time.Num();
+
+            EaseManager::EvaluateBatch(bucket->Tweeners[0]->EaseType, bucket->Time.GetData(), bucket->Duration.GetData(),
+                bucket->OvershootOrAmplitude.GetData(), bucket->Period.GetData(), bucket->Ratio.GetData(), cnt);
+
+            const float* ratio = bucket->Ratio.GetData();
+            for (int32 k = 0; k < valueSize; k++)
+            {
+                const float* start = bucket->Start[k].GetData();
+                const float* end = bucket->End[k].GetData();
+                float* output = bucket->Output[k].GetData();
+                for (int32 i = 0; i < cnt; i += 4)
+                {
+                    VectorRegister4Float n1 = VectorLoad(start + i);
+                    VectorRegister4Float n2 = VectorLoad(end + i);
+                    VectorStore(VectorMultiplyAdd(VectorSubtract(n2, n1), VectorLoad(ratio + i), n1), output + i);
+                }
+            }
+        }
+    }
+
+    //second pass: apply the values and dispatch callbacks. A callback may kill or pause a tweener
+    //that is later in the batch, which then must not be updated, as in the unbatched path.
+    for (FTweenBucket* bucket : ActiveBuckets)
+    {
+        int32 valueSize = bucket->Tweeners[0]->ValueSize;
+        int32 cnt = bucket->Tweeners.Num();
+        INC_DWORD_STAT_BY(STAT_FairyGUI_TweensBatched, cnt);
+
+        float values[4];
+        for (int32 i = 0; i < cnt; i++)
+        {
+            FGTweener* tweener = bucket->Tweeners[i];
+            if (tweener->bKilled || tweener->bPaused)
+                continue;
+
+            for (int32 k = 0; k < valueSize; k++)
+                values[k] = bucket->Output[k][i];
+            tweener->EndBatchUpdate(bucket->Ratio[i], values);
+        }
+        bucket->Reset(valueSize);
+    }
+    ActiveBuckets.Reset();
 }
\ No newline at end of file
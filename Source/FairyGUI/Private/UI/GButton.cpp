@@ -132,7 +132,11 @@ void UGButton::SetSelected(bool bInSelected)
 
 void UGButton::SetRelatedController(UGController* InController)
 {
+    if (RelatedController != nullptr)
+        RelatedController->RemoveSubscriber(this);
     RelatedController = InController;
+    if (RelatedController != nullptr)
+        RelatedController->AddSubscriber(this);
 }
 
 void UGButton::SetState(const FString& InState)
@@ -326,7 +330,7 @@ void UGButton::SetupAfterAdd(FByteBuffer* Buffer, int32 BeginPos)
         SetTitleFontSize(iv);
     iv = Buffer->ReadShort();
     if (iv >= 0)
-        RelatedController = GetParent()->GetControllerAt(iv);
+        SetRelatedController(GetParent()->GetControllerAt(iv));
     RelatedPageID = Buffer->ReadS();
 
     Buffer->ReadS(Sound);
@@ -174,6 +174,15 @@ void UGComboBox::SetCurrentState()
         SetState(bOver ? UGButton::OVER : UGButton::UP);
 }
 
+void UGComboBox::SetSelectionController(UGController* InController)
+{
+    if (SelectionController != nullptr)
+        SelectionController->RemoveSubscriber(this);
+    SelectionController = InController;
+    if (SelectionController != nullptr)
+        SelectionController->AddSubscriber(this);
+}
+
 void UGComboBox::UpdateSelectionController()
 {
     if (SelectionController != nullptr && !SelectionController->bChanging && SelectedIndex < SelectionController->GetPageCount())
@@ -393,7 +402,7 @@ void UGComboBox::SetupAfterAdd(FByteBuffer* Buffer, int32 BeginPos)
 
     iv = Buffer->ReadShort();
     if (iv >= 0)
-        SelectionController = GetParent()->GetControllerAt(iv);
+        SetSelectionController(GetParent()->GetControllerAt(iv));
 }
 
 void UGComboBox::OnClickItem(UEventContext* Context)
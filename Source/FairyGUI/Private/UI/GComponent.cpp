@@ -14,6 +14,118 @@
 #include "Tween/GTween.h"
 #include "FairyApplication.h"
 
+DECLARE_CYCLE_STAT(TEXT("Construct Component"), STAT_FairyGUI_ConstructComponent, STATGROUP_FairyGUI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Component Templates"), STAT_FairyGUI_ComponentTemplates, STATGROUP_FairyGUI);
+
+// Block offsets, resolved child items, controller page tables and relation records of a component,
+// compiled once per package item so repeated instantiation does not walk the block tables,
+// look children up by ID or decode the same strings again. Gears, transitions and controller
+// actions are still read from the buffer per instance.
+struct FComponentTemplate
+{
+	struct FChild
+	{
+		EObjectType Type;
+		FString PackageID;
+		FString ResourceID;
+		TWeakPtr<FPackageItem> Item;
+		int32 BlockPos;
+		TArray<FRelationRecord> Relations;
+	};
+
+	TArray<FControllerRecord> Controllers;
+	TArray<FChild> Children;
+	TArray<FRelationRecord> Relations;
+	TArray<int32> TransitionPositions;
+
+	static TSharedRef<FComponentTemplate> Compile(const TSharedPtr<FPackageItem>& ContentItem);
+	TSharedPtr<FPackageItem> ResolveChildItem(FChild& Child, UUIPackage* Owner) const;
+};
+
+TSharedRef<FComponentTemplate> FComponentTemplate::Compile(const TSharedPtr<FPackageItem>& ContentItem)
+{
+	INC_DWORD_STAT(STAT_FairyGUI_ComponentTemplates);
+
+	TSharedRef<FComponentTemplate> Template = MakeShared<FComponentTemplate>();
+	FByteBuffer* Buffer = ContentItem->RawData.Get();
+
+	Buffer->Seek(0, 1);
+
+	int32 controllerCount = Buffer->ReadShort();
+	Template->Controllers.SetNum(controllerCount);
+	for (int32 i = 0; i < controllerCount; i++)
+	{
+		int32 nextPos = Buffer->ReadShort();
+		nextPos += Buffer->GetPos();
+
+		UGController::Decode(Buffer, Template->Controllers[i]);
+
+		Buffer->SetPos(nextPos);
+	}
+
+	Buffer->Seek(0, 2);
+
+	int32 childCount = Buffer->ReadShort();
+	Template->Children.Reserve(childCount);
+	for (int32 i = 0; i < childCount; i++)
+	{
+		int32 dataLen = Buffer->ReadShort();
+		int32 curPos = Buffer->GetPos();
+
+		Buffer->Seek(curPos, 0);
+
+		FChild& Child = Template->Children.AddDefaulted_GetRef();
+		Child.Type = (EObjectType)Buffer->ReadByte();
+		Child.ResourceID = Buffer->ReadS();
+		Child.PackageID = Buffer->ReadS();
+		Child.BlockPos = curPos;
+		Template->ResolveChildItem(Child, ContentItem->Owner);
+
+		Buffer->Seek(curPos, 3);
+		FRelations::Decode(Buffer, Child.Relations);
+
+		Buffer->SetPos(curPos + dataLen);
+	}
+
+	Buffer->Seek(0, 3);
+	FRelations::Decode(Buffer, Template->Relations);
+
+	Buffer->Seek(0, 5);
+
+	int32 transitionCount = Buffer->ReadShort();
+	Template->TransitionPositions.Reserve(transitionCount);
+	for (int32 i = 0; i < transitionCount; i++)
+	{
+		int32 nextPos = Buffer->ReadShort();
+		nextPos += Buffer->GetPos();
+
+		Template->TransitionPositions.Add(Buffer->GetPos());
+
+		Buffer->SetPos(nextPos);
+	}
+
+	return Template;
+}
+
+TSharedPtr<FPackageItem> FComponentTemplate::ResolveChildItem(FChild& Child, UUIPackage* Owner) const
+{
+	if (Child.ResourceID.IsEmpty())
+		return nullptr;
+
+	TSharedPtr<FPackageItem> pii = Child.Item.Pin();
+	if (!pii.IsValid())
+	{
+		// Cross-package references are resolved again if the target package was reloaded.
+		UUIPackage* pkg = Child.PackageID.IsEmpty() ? Owner : UUIPackage::GetPackageByID(Child.PackageID);
+		if (pkg != nullptr)
+		{
+			pii = pkg->GetItem(Child.ResourceID);
+			Child.Item = pii;
+		}
+	}
+	return pii;
+}
+
 
 UGComponent::UGComponent() :
 	AlignOffset(ForceInit)
@@ -51,6 +163,7 @@ UGObject* UGComponent::AddChildAt(UGObject* Child, int32 Index)
 	{
 		Child->RemoveFromParent();
 		Child->Parent = this;
+		++SDisplayObject::HierarchyRevision;
 
 		int32 cnt = Children.Num();
 		if (Child->SortingOrder != 0)
@@ -107,6 +220,7 @@ void UGComponent::RemoveChildAt(int32 Index)
 	UGObject* Child = Children[Index];
 
 	Child->Parent = nullptr;
+	++SDisplayObject::HierarchyRevision;
 
 	if (Child->SortingOrder != 0)
 		SortingChildCount--;
@@ -272,6 +386,9 @@ int32 UGComponent::MoveChild(UGObject* Child, int32 OldIndex, int32 Index)
 	else
 		Children.Insert(Child, Index);
 
+	if (Child->Group.IsValid())
+		Child->Group->InvalidateMembers();
+
 	if (Child->DisplayObject->IsParentValid())
 	{
 		int32 DisplayIndex = 0;
@@ -414,8 +531,33 @@ void UGComponent::ApplyController(UGController* Controller)
 {
 	ApplyingController = Controller;
 
-	for (int32 i = 0; i < Children.Num(); i++)
-		Children[i]->HandleControllerChanged(Controller);
+	//only children bound to the controller are notified, but in child order like before.
+	//subscribers are stamped, then collected in child order before any of them reacts,
+	//since reactions may reorder children or apply other controllers
+	static uint32 NotifyStamp = 0;
+	if (++NotifyStamp == 0)
+		NotifyStamp = 1;
+
+	int32 BoundCount = 0;
+	for (int32 i = 0; i < Controller->GetSubscriberCount(); i++)
+	{
+		UGObject* Obj = Controller->GetSubscriberAt(i);
+		if (Obj != nullptr && Obj->GetParent() == this && Obj->ControllerStamp != NotifyStamp)
+		{
+			Obj->ControllerStamp = NotifyStamp;
+			BoundCount++;
+		}
+	}
+
+	TArray<UGObject*, TInlineAllocator<16>> Bound;
+	for (int32 i = 0; i < Children.Num() && Bound.Num() < BoundCount; i++)
+	{
+		if (Children[i]->ControllerStamp == NotifyStamp)
+			Bound.Add(Children[i]);
+	}
+
+	for (UGObject* Child : Bound)
+		Child->HandleControllerChanged(Controller);
 
 	ApplyingController = nullptr;
 
@@ -483,6 +625,17 @@ void UGComponent::SetOpaque(bool bInOpaque)
 	DisplayObject->SetOpaque(bInOpaque);
 }
 
+bool UGComponent::IsLayerBatching() const
+{
+	return Container->IsLayerBatching();
+}
+
+void UGComponent::SetLayerBatching(bool bInLayerBatching)
+{
+	RootContainer->SetLayerBatching(bInLayerBatching);
+	Container->SetLayerBatching(bInLayerBatching);
+}
+
 void UGComponent::SetMargin(const FMargin& InMargin)
 {
 	Margin = InMargin;
@@ -561,6 +714,8 @@ void UGComponent::SetBoundsChangedFlag()
 
 void UGComponent::EnsureBoundsCorrect()
 {
+	FRelations::SolvePending();
+
 	if (bBoundsChanged)
 		UpdateBounds();
 }
@@ -839,6 +994,7 @@ void UGComponent::SetupOverflow(EOverflowType InOverflow)
 	{
 		DisplayObject->SetClipping(EWidgetClipping::ClipToBoundsAlways);
 		DisplayObject->SetCullingBoundsExtension(Margin);
+		DisplayObject->InvalidatePaintBounds();
 	}
 
 	Container->SetPosition(Margin.GetTopLeft());
@@ -904,6 +1060,8 @@ void UGComponent::ConstructFromResource()
 
 void UGComponent::ConstructFromResource(TArray<UGObject*>* ObjectPool, int32 PoolIndex)
 {
+	SCOPE_CYCLE_COUNTER(STAT_FairyGUI_ConstructComponent);
+
 	TSharedPtr<FPackageItem> ContentItem = PackageItem->GetBranch();
 
 	if (!ContentItem->bTranslated)
@@ -962,100 +1120,54 @@ void UGComponent::ConstructFromResource(TArray<UGObject*>* ObjectPool, int32 Poo
 
 	bBuildingDisplayList = true;
 
-	Buffer->Seek(0, 1);
+	if (!ContentItem->ComponentTemplate.IsValid())
+		ContentItem->ComponentTemplate = FComponentTemplate::Compile(ContentItem);
+	FComponentTemplate& Template = *ContentItem->ComponentTemplate;
 
-	int32 controllerCount = Buffer->ReadShort();
-	for (int32 i = 0; i < controllerCount; i++)
+	for (const FControllerRecord& Record : Template.Controllers)
 	{
-		int32 nextPos = Buffer->ReadShort();
-		nextPos += Buffer->GetPos();
-
 		UGController* Controller = NewObject<UGController>(this);
 		Controllers.Add(Controller);
-		Controller->Setup(Buffer);
-
-		Buffer->SetPos(nextPos);
+		Controller->Setup(Record, Buffer);
 	}
 
-	Buffer->Seek(0, 2);
-
 	UGObject* Child;
-	int32 childCount = Buffer->ReadShort();
+	int32 childCount = Template.Children.Num();
+	Children.Reserve(Children.Num() + childCount);
 	for (int32 i = 0; i < childCount; i++)
 	{
-		int32 dataLen = Buffer->ReadShort();
-		int32 curPos = Buffer->GetPos();
+		FComponentTemplate::FChild& ChildTemplate = Template.Children[i];
 
 		if (ObjectPool != nullptr)
 			Child = (*ObjectPool)[PoolIndex + i];
 		else
 		{
-			Buffer->Seek(curPos, 0);
-
-			EObjectType type = (EObjectType)Buffer->ReadByte();
-			const FString& src = Buffer->ReadS();
-			const FString& pkgId = Buffer->ReadS();
-
-			TSharedPtr<FPackageItem> pii;
-			if (!src.IsEmpty())
-			{
-				UUIPackage* pkg;
-				if (!pkgId.IsEmpty())
-					pkg = UUIPackage::GetPackageByID(pkgId);
-				else
-					pkg = ContentItem->Owner;
-
-				if (pkg != nullptr)
-					pii = pkg->GetItem(src);
-			}
-
+			TSharedPtr<FPackageItem> pii = Template.ResolveChildItem(ChildTemplate, ContentItem->Owner);
 			if (pii.IsValid())
 			{
 				Child = FUIObjectFactory::NewObject(pii, this);
 				Child->ConstructFromResource();
 			}
 			else
-				Child = FUIObjectFactory::NewObject(type, this);
+				Child = FUIObjectFactory::NewObject(ChildTemplate.Type, this);
 		}
 
 		Child->bUnderConstruct = true;
-		Child->SetupBeforeAdd(Buffer, curPos);
+		Child->SetupBeforeAdd(Buffer, ChildTemplate.BlockPos);
 		Child->Parent = this;
 		Children.Add(Child);
-
-		Buffer->SetPos(curPos + dataLen);
 	}
 
-	Buffer->Seek(0, 3);
-	Relations->Setup(Buffer, true);
-
-	Buffer->Seek(0, 2);
-	Buffer->Skip(2);
+	Relations->Setup(Template.Relations, true);
 
 	for (int32 i = 0; i < childCount; i++)
-	{
-		int32 nextPos = Buffer->ReadShort();
-		nextPos += Buffer->GetPos();
-
-		Buffer->Seek(Buffer->GetPos(), 3);
-		Children[i]->GetRelations()->Setup(Buffer, false);
-
-		Buffer->SetPos(nextPos);
-	}
-
-	Buffer->Seek(0, 2);
-	Buffer->Skip(2);
+		Children[i]->GetRelations()->Setup(Template.Children[i].Relations, false);
 
 	for (int32 i = 0; i < childCount; i++)
 	{
-		int32 nextPos = Buffer->ReadShort();
-		nextPos += Buffer->GetPos();
-
 		Child = Children[i];
-		Child->SetupAfterAdd(Buffer, Buffer->GetPos());
+		Child->SetupAfterAdd(Buffer, Template.Children[i].BlockPos);
 		Child->bUnderConstruct = false;
-
-		Buffer->SetPos(nextPos);
 	}
 
 	Buffer->Seek(0, 4);
@@ -1105,19 +1217,13 @@ void UGComponent::ConstructFromResource(TArray<UGObject*>* ObjectPool, int32 Poo
 		}
 	}
 
-	Buffer->Seek(0, 5);
-
-	int32 transitionCount = Buffer->ReadShort();
-	for (int32 i = 0; i < transitionCount; i++)
+	for (int32 Pos : Template.TransitionPositions)
 	{
-		int32 nextPos = Buffer->ReadShort();
-		nextPos += Buffer->GetPos();
+		Buffer->SetPos(Pos);
 
 		UTransition* Transition = NewObject<UTransition>(this);
 		Transitions.Add(Transition);
 		Transition->Setup(Buffer);
-
-		Buffer->SetPos(nextPos);
 	}
 
 	if (Transitions.Num() > 0)
@@ -1157,7 +1263,7 @@ void UGComponent::SetupAfterAdd(FByteBuffer* Buffer, int32 BeginPos)
 
 	int32 pageController = Buffer->ReadShort();
 	if (pageController != -1 && ScrollPane != nullptr && ScrollPane->bPageMode)
-		ScrollPane->PageController = Parent->GetControllerAt(pageController);
+		ScrollPane->SetPageController(Parent->GetControllerAt(pageController));
 
 	int32 cnt = Buffer->ReadShort();
 	for (int32 i = 0; i < cnt; i++)
@@ -94,7 +94,7 @@ bool UGController::HasPage(const FString& PageName) const
 
 int32 UGController::GetPageIndexByID(const FString& PageID) const
 {
-    return PageIDs.Find(PageID) != INDEX_NONE;
+    return PageIDs.Find(PageID);
 }
 
 const FString& UGController::GetPageNameByID(const FString& PageID) const
@@ -129,54 +129,117 @@ void UGController::RunActions()
         it.Run(this, GetPreviousPageID(), GetSelectedPageID());
 }
 
+void UGController::AddSubscriber(UGObject* Obj)
+{
+    if (Obj == nullptr)
+        return;
+
+    for (int32 i = Subscribers.Num() - 1; i >= 0; i--)
+    {
+        FSubscriber& Subscriber = Subscribers[i];
+        if (Subscriber.Object.Get() == Obj)
+        {
+            Subscriber.RefCount++;
+            return;
+        }
+        else if (!Subscriber.Object.IsValid())
+            Subscribers.RemoveAt(i);
+    }
+
+    Subscribers.Add({ Obj, 1 });
+}
+
+void UGController::RemoveSubscriber(UGObject* Obj)
+{
+    if (Obj == nullptr)
+        return;
+
+    for (int32 i = 0; i < Subscribers.Num(); i++)
+    {
+        FSubscriber& Subscriber = Subscribers[i];
+        if (Subscriber.Object.Get() == Obj)
+        {
+            if (--Subscriber.RefCount == 0)
+                Subscribers.RemoveAt(i);
+            return;
+        }
+    }
+}
+
 void UGController::Setup(FByteBuffer* Buffer)
+{
+    FControllerRecord Record;
+    Decode(Buffer, Record);
+    Setup(Record, Buffer);
+}
+
+void UGController::Decode(FByteBuffer* Buffer, FControllerRecord& OutRecord)
 {
     int32 BeginPos = Buffer->GetPos();
     Buffer->Seek(BeginPos, 0);
 
-    Name = Buffer->ReadS();
-    bAutoRadioGroupDepth = Buffer->ReadBool();
+    OutRecord.Name = Buffer->ReadS();
+    OutRecord.bAutoRadioGroupDepth = Buffer->ReadBool();
 
     Buffer->Seek(BeginPos, 1);
 
     int32 cnt = Buffer->ReadShort();
-    PageIDs.SetNum(cnt);
-    PageNames.SetNum(cnt);
+    OutRecord.PageIDs.SetNum(cnt);
+    OutRecord.PageNames.SetNum(cnt);
     for (int32 i = 0; i < cnt; i++)
     {
-        PageIDs[i] = Buffer->ReadS();
-        PageNames[i] = Buffer->ReadS();
+        OutRecord.PageIDs[i] = Buffer->ReadS();
+        OutRecord.PageNames[i] = Buffer->ReadS();
     }
 
-    int32 HomePageIndex = 0;
     if (Buffer->Version >= 2)
     {
-        int32 HomePageType = Buffer->ReadByte();
-        switch (HomePageType)
-        {
-        case 1:
-            HomePageIndex = Buffer->ReadShort();
-            break;
-
-        case 2:
-            HomePageIndex = PageNames.Find(UUIPackage::GetBranch());
-            if (HomePageIndex == INDEX_NONE)
-                HomePageIndex = 0;
-            break;
-
-        case 3:
-            HomePageIndex = PageNames.Find(UUIPackage::GetVar(Buffer->ReadS()));
-            if (HomePageIndex == INDEX_NONE)
-                HomePageIndex = 0;
-            break;
-        }
+        OutRecord.HomePageType = Buffer->ReadByte();
+        if (OutRecord.HomePageType == 1)
+            OutRecord.HomePageIndex = Buffer->ReadShort();
+        else if (OutRecord.HomePageType == 3)
+            OutRecord.HomePageVar = Buffer->ReadS();
     }
 
     Buffer->Seek(BeginPos, 2);
 
-    cnt = Buffer->ReadShort();
-    if (cnt > 0)
+    if (Buffer->ReadShort() > 0)
+        OutRecord.ActionsPos = Buffer->GetPos() - 2;
+}
+
+void UGController::Setup(const FControllerRecord& Record, FByteBuffer* Buffer)
+{
+    Name = Record.Name;
+    bAutoRadioGroupDepth = Record.bAutoRadioGroupDepth;
+    PageIDs = Record.PageIDs;
+    PageNames = Record.PageNames;
+
+    //branches and variables may change between instantiations, so they are looked up every time
+    int32 HomePageIndex = 0;
+    switch (Record.HomePageType)
     {
+    case 1:
+        HomePageIndex = Record.HomePageIndex;
+        break;
+
+    case 2:
+        HomePageIndex = PageNames.Find(UUIPackage::GetBranch());
+        if (HomePageIndex == INDEX_NONE)
+            HomePageIndex = 0;
+        break;
+
+    case 3:
+        HomePageIndex = PageNames.Find(UUIPackage::GetVar(Record.HomePageVar));
+        if (HomePageIndex == INDEX_NONE)
+            HomePageIndex = 0;
+        break;
+    }
+
+    if (Record.ActionsPos != -1)
+    {
+        Buffer->SetPos(Record.ActionsPos);
+
+        int32 cnt = Buffer->ReadShort();
         for (int32 i = 0; i < cnt; i++)
         {
             int32 nextPos = Buffer->ReadShort();
@@ -8,7 +8,10 @@
 UGGroup::UGGroup() :
     MainGridIndex(-1),
     MainGridMinSize(10),
-    MainChildIndex(-1)
+    MainChildIndex(-1),
+    Extent(ForceInit),
+    FirstDirtyMember(INDEX_NONE),
+    bMembersValid(false)
 {
     DisplayObject = SNew(SDisplayObject).GObject(this);;
     DisplayObject->SetInteractable(false);
@@ -81,6 +84,36 @@ void UGGroup::SetMainGridMinSize(int32 InSize)
 }
 
 void UGGroup::SetBoundsChangedFlag(bool bPositionChangedOnly)
+{
+    if (Updating == 0 && Parent.IsValid())
+    {
+        FirstDirtyMember = 0;
+        DirtyMembers.SetRange(0, DirtyMembers.Num(), true);
+    }
+
+    MarkBoundsChanged(bPositionChangedOnly);
+}
+
+void UGGroup::OnMemberChanged(UGObject* Member, bool bPositionChangedOnly)
+{
+    int32 Index = Member->IndexInGroup;
+    if (bMembersValid && Members.IsValidIndex(Index) && Members[Index] == Member)
+    {
+        //bounds are refreshed even for moves made by the group itself
+        DirtyMembers[Index] = true;
+        if (Updating == 0 && (FirstDirtyMember == INDEX_NONE || Index < FirstDirtyMember))
+            FirstDirtyMember = Index;
+    }
+
+    MarkBoundsChanged(bPositionChangedOnly);
+}
+
+void UGGroup::InvalidateMembers()
+{
+    bMembersValid = false;
+}
+
+void UGGroup::MarkBoundsChanged(bool bPositionChangedOnly)
 {
     if (Updating == 0 && Parent.IsValid())
     {
@@ -99,12 +132,51 @@ void UGGroup::SetBoundsChangedFlag(bool bPositionChangedOnly)
     }
 }
 
+void UGGroup::EnsureMembers()
+{
+    if (bMembersValid && MembersParent == Parent)
+        return;
+
+    bMembersValid = true;
+    MembersParent = Parent;
+    Members.Reset();
+
+    if (Parent.IsValid())
+    {
+        int32 cnt = Parent->NumChildren();
+        for (int32 i = 0; i < cnt; i++)
+        {
+            UGObject* child = Parent->GetChildAt(i);
+            if (child->Group.Get() == this)
+            {
+                child->IndexInGroup = Members.Num();
+                Members.Add(child);
+            }
+        }
+    }
+
+    MemberBounds.Init(FBox2D(ForceInit), Members.Num());
+    DirtyMembers.Init(true, Members.Num());
+    Extent = FBox2D(ForceInit);
+    FirstDirtyMember = 0;
+    bPercentReady = false;
+}
+
+FBox2D UGGroup::GetMemberBounds(UGObject* Member) const
+{
+    if (bExcludeInvisibles && !Member->InternalVisible3())
+        return FBox2D(ForceInit);
+
+    return FBox2D(Member->GetPosition(), Member->GetPosition() + Member->GetSize());
+}
+
 void UGGroup::EnsureBoundsCorrect()
 {
     if (!Parent.IsValid() || !bBoundsChanged)
         return;
 
     bBoundsChanged = false;
+    EnsureMembers();
 
     if (bAutoSizeDisabled)
         ResizeChildren(FVector2D::ZeroVector);
@@ -117,46 +189,44 @@ void UGGroup::EnsureBoundsCorrect()
 
 void UGGroup::UpdateBounds()
 {
-    int32 cnt = Parent->NumChildren();
-    int32 i;
-    UGObject* child;
-    float ax = FLT_MAX, ay = FLT_MAX;
-    float ar = FLT_MIN, ab = FLT_MIN;
-    float tmp;
-    bool empty = true;
-
-    for (i = 0; i < cnt; i++)
+    EnsureMembers();
+
+    //members can only widen the extent unless one of them used to sit on its edge
+    bool bRecompute = !Extent.bIsValid;
+    for (TConstSetBitIterator<> It(DirtyMembers); It; ++It)
     {
-        child = Parent->GetChildAt(i);
-        if (child->GetGroup() != this || (bExcludeInvisibles && !child->InternalVisible3()))
+        int32 i = It.GetIndex();
+        FBox2D OldBounds = MemberBounds[i];
+        MemberBounds[i] = GetMemberBounds(Members[i]);
+        if (bRecompute)
             continue;
 
-        tmp = child->GetX();
-        if (tmp < ax)
-            ax = tmp;
-        tmp = child->GetY();
-        if (tmp < ay)
-            ay = tmp;
-        tmp = child->GetX() + child->GetWidth();
-        if (tmp > ar)
-            ar = tmp;
-        tmp = child->GetY() + child->GetHeight();
-        if (tmp > ab)
-            ab = tmp;
-
-        empty = false;
+        if (OldBounds.bIsValid
+            && (OldBounds.Min.X <= Extent.Min.X || OldBounds.Min.Y <= Extent.Min.Y
+                || OldBounds.Max.X >= Extent.Max.X || OldBounds.Max.Y >= Extent.Max.Y))
+            bRecompute = true;
+        else
+            Extent += MemberBounds[i];
+    }
+    DirtyMembers.SetRange(0, DirtyMembers.Num(), false);
+
+    if (bRecompute)
+    {
+        Extent = FBox2D(ForceInit);
+        for (auto& it : MemberBounds)
+            Extent += it;
     }
 
     float w;
     float h;
-    if (!empty)
+    if (Extent.bIsValid)
     {
         Updating |= 1;
-        SetPosition(FVector2D(ax, ay));
+        SetPosition(Extent.Min);
         Updating &= 2;
 
-        w = ar - ax;
-        h = ab - ay;
+        w = Extent.Max.X - Extent.Min.X;
+        h = Extent.Max.Y - Extent.Min.Y;
     }
     else
         w = h = 0;
@@ -176,17 +246,33 @@ void UGGroup::UpdateBounds()
 
 void UGGroup::HandleLayout()
 {
+    int32 first = FirstDirtyMember;
+    FirstDirtyMember = INDEX_NONE;
+    if (first == INDEX_NONE || first >= Members.Num())
+        return;
+
     Updating |= 1;
 
+    //members before the first dirty one keep their places, continue the flow after them
     if (Layout == EGroupLayoutType::Horizontal)
     {
         float curX = GetX();
-        int32 cnt = Parent->NumChildren();
-        for (int32 i = 0; i < cnt; i++)
+        for (int32 i = first - 1; i >= 0; i--)
         {
-            UGObject* child = Parent->GetChildAt(i);
-            if (child->GetGroup() != this)
+            UGObject* child = Members[i];
+            if (bExcludeInvisibles && !child->InternalVisible3())
                 continue;
+
+            curX = child->GetXMin();
+            if (child->GetWidth() != 0)
+                curX += child->GetWidth() + ColumnGap;
+            break;
+        }
+
+        int32 cnt = Members.Num();
+        for (int32 i = first; i < cnt; i++)
+        {
+            UGObject* child = Members[i];
             if (bExcludeInvisibles && !child->InternalVisible3())
                 continue;
 
@@ -198,12 +284,22 @@ void UGGroup::HandleLayout()
     else if (Layout == EGroupLayoutType::Vertical)
     {
         float curY = GetY();
-        int32 cnt = Parent->NumChildren();
-        for (int32 i = 0; i < cnt; i++)
+        for (int32 i = first - 1; i >= 0; i--)
         {
-            UGObject* child = Parent->GetChildAt(i);
-            if (child->GetGroup() != this)
+            UGObject* child = Members[i];
+            if (bExcludeInvisibles && !child->InternalVisible3())
                 continue;
+
+            curY = child->GetYMin();
+            if (child->GetHeight() != 0)
+                curY += child->GetHeight() + LineGap;
+            break;
+        }
+
+        int32 cnt = Members.Num();
+        for (int32 i = first; i < cnt; i++)
+        {
+            UGObject* child = Members[i];
             if (bExcludeInvisibles && !child->InternalVisible3())
                 continue;
 
@@ -223,15 +319,9 @@ void UGGroup::MoveChildren(const FVector2D& Delta)
 
     Updating |= 1;
 
-    int32 cnt = Parent->NumChildren();
-    for (int32 i = 0; i < cnt; i++)
-    {
-        UGObject* child = Parent->GetChildAt(i);
-        if (child->GetGroup() == this)
-        {
-            child->SetPosition(child->GetPosition() + Delta);
-        }
-    }
+    EnsureMembers();
+    for (auto& child : Members)
+        child->SetPosition(child->GetPosition() + Delta);
 
     Updating &= 2;
 }
@@ -253,7 +343,10 @@ void UGGroup::ResizeChildren(const FVector2D& Delta)
         }
     }
 
-    int32 cnt = Parent->NumChildren();
+    EnsureMembers();
+    FirstDirtyMember = INDEX_NONE;
+
+    int32 cnt = Members.Num();
 
     if (!bPercentReady)
     {
@@ -262,16 +355,12 @@ void UGGroup::ResizeChildren(const FVector2D& Delta)
         TotalSize = 0;
         MainChildIndex = -1;
 
-        int32 j = 0;
         for (int32 i = 0; i < cnt; i++)
         {
-            UGObject* child = Parent->GetChildAt(i);
-            if (child->GetGroup() != this)
-                continue;
-
+            UGObject* child = Members[i];
             if (!bExcludeInvisibles || child->InternalVisible3())
             {
-                if (j == MainGridIndex)
+                if (i == MainGridIndex)
                     MainChildIndex = i;
 
                 NumChildren++;
@@ -281,21 +370,19 @@ void UGGroup::ResizeChildren(const FVector2D& Delta)
                 else
                     TotalSize += child->GetHeight();
             }
-
-            j++;
         }
 
         if (MainChildIndex != -1)
         {
             if (Layout == EGroupLayoutType::Horizontal)
             {
-                UGObject* child = Parent->GetChildAt(MainChildIndex);
+                UGObject* child = Members[MainChildIndex];
                 TotalSize += MainGridMinSize - child->GetWidth();
                 child->SizePercentInGroup = MainGridMinSize / TotalSize;
             }
             else
             {
-                UGObject* child = Parent->GetChildAt(MainChildIndex);
+                UGObject* child = Members[MainChildIndex];
                 TotalSize += MainGridMinSize - child->GetHeight();
                 child->SizePercentInGroup = MainGridMinSize / TotalSize;
             }
@@ -303,13 +390,10 @@ void UGGroup::ResizeChildren(const FVector2D& Delta)
 
         for (int32 i = 0; i < cnt; i++)
         {
-            UGObject* child = Parent->GetChildAt(i);
-            if (child->GetGroup() != this)
-                continue;
-
             if (i == MainChildIndex)
                 continue;
 
+            UGObject* child = Members[i];
             if (TotalSize > 0)
                 child->SizePercentInGroup = (Layout == EGroupLayoutType::Horizontal ? child->GetWidth() : child->GetHeight()) / TotalSize;
             else
@@ -326,7 +410,7 @@ void UGGroup::ResizeChildren(const FVector2D& Delta)
         remainSize = GetWidth() - (NumChildren - 1) * ColumnGap;
         if (MainChildIndex != -1 && remainSize >= TotalSize)
         {
-            UGObject* child = Parent->GetChildAt(MainChildIndex);
+            UGObject* child = Members[MainChildIndex];
             child->SetSize(FVector2D(remainSize - (TotalSize - MainGridMinSize), child->RawSize.Y + Delta.Y), true);
             remainSize -= child->GetWidth();
             remainPercent -= child->SizePercentInGroup;
@@ -336,10 +420,7 @@ void UGGroup::ResizeChildren(const FVector2D& Delta)
         float curX = GetX();
         for (int32 i = 0; i < cnt; i++)
         {
-            UGObject* child = Parent->GetChildAt(i);
-            if (child->GetGroup() != this)
-                continue;
-
+            UGObject* child = Members[i];
             if (bExcludeInvisibles && !child->InternalVisible3())
             {
                 child->SetSize(FVector2D(child->RawSize.X, child->RawSize.Y + Delta.Y), true);
@@ -363,7 +444,7 @@ void UGGroup::ResizeChildren(const FVector2D& Delta)
         remainSize = GetHeight() - (NumChildren - 1) * LineGap;
         if (MainChildIndex != -1 && remainSize >= TotalSize)
         {
-            UGObject* child = Parent->GetChildAt(MainChildIndex);
+            UGObject* child = Members[MainChildIndex];
             child->SetSize(FVector2D(child->RawSize.X + Delta.X, remainSize - (TotalSize - MainGridMinSize)), true);
             remainSize -= child->GetHeight();
             remainPercent -= child->SizePercentInGroup;
@@ -373,10 +454,7 @@ void UGGroup::ResizeChildren(const FVector2D& Delta)
         float curY = GetY();
         for (int32 i = 0; i < cnt; i++)
         {
-            UGObject* child = Parent->GetChildAt(i);
-            if (child->GetGroup() != this)
-                continue;
-
+            UGObject* child = Members[i];
             if (bExcludeInvisibles && !child->InternalVisible3())
             {
                 child->SetSize(FVector2D(child->RawSize.X + Delta.X, child->RawSize.Y), true);
@@ -406,13 +484,9 @@ void UGGroup::HandleAlphaChanged()
     if (bUnderConstruct)
         return;
 
-    int32 cnt = Parent->NumChildren();
-    for (int32 i = 0; i < cnt; i++)
-    {
-        UGObject* child = Parent->GetChildAt(i);
-        if (child->GetGroup() == this)
-            child->SetAlpha(Alpha);
-    }
+    EnsureMembers();
+    for (auto& child : Members)
+        child->SetAlpha(Alpha);
 }
 
 void UGGroup::HandleVisibleChanged()
@@ -420,13 +494,9 @@ void UGGroup::HandleVisibleChanged()
     if (!Parent.IsValid())
         return;
 
-    int32 cnt = Parent->NumChildren();
-    for (int32 i = 0; i < cnt; i++)
-    {
-        UGObject* child = Parent->GetChildAt(i);
-        if (child->GetGroup() == this)
-            child->HandleVisibleChanged();
-    }
+    EnsureMembers();
+    for (auto& child : Members)
+        child->HandleVisibleChanged();
 }
 
 void UGGroup::SetupBeforeAdd(FByteBuffer* Buffer, int32 BeginPos)
@@ -8,18 +8,12 @@
 #include "Widgets/SContainer.h"
 #include "FairyApplication.h"
 
-UGList::FItemInfo::FItemInfo() :
-    Obj(nullptr),
-    UpdateFlag(0),
-    bSelected(false)
-{
-}
-
 UGList::UGList() :
     bScrollItemToViewOnClick(true),
     bAutoResizeItem(true),
     LastSelectedIndex(-1),
-    FirstIndex(-1)
+    FirstIndex(-1),
+    bLineIndexDirty(true)
 {
     bTrackBounds = true;
     SetOpaque(true);
@@ -155,6 +149,11 @@ void UGList::ReturnToPool(UGObject* Obj)
     Pool->ReturnObject(Obj);
 }
 
+void UGList::PrewarmPool(int32 Count, const FString& URL, bool bHighPriority, int32 MaxIdle)
+{
+    Pool->Prewarm(URL.Len() == 0 ? DefaultItem : URL, Count, this, bHighPriority, MaxIdle > 0 ? MaxIdle : MAX_int32);
+}
+
 UGObject* UGList::AddItemFromPool(const FString& URL)
 {
     UGObject* Obj = GetFromPool(URL);
@@ -210,18 +209,25 @@ int32 UGList::GetSelectedIndex() const
 {
     if (bVirtual)
     {
-        int32 cnt = RealNumItems;
-        for (int32 i = 0; i < cnt; i++)
+        int32 ret = -1;
+        for (TConstSetBitIterator<> It(ItemSelected); It; ++It)
         {
-            const FItemInfo& ii = VirtualItems[i];
-            if ((Cast<UGButton>(ii.Obj) && ((UGButton*)ii.Obj)->IsSelected()) || (ii.Obj == nullptr && ii.bSelected))
+            if (!ItemObjects.Contains(It.GetIndex()))
             {
-                if (bLoop)
-                    return i % NumItems;
-                else
-                    return i;
+                ret = It.GetIndex();
+                break;
             }
         }
+        for (auto& it : ItemObjects)
+        {
+            if ((ret == -1 || it.Key < ret) && it.Key < RealNumItems && IsItemSelected(it.Key))
+                ret = it.Key;
+        }
+
+        if (ret != -1 && bLoop)
+            return ret % NumItems;
+        else
+            return ret;
     }
     else
     {
@@ -250,7 +256,11 @@ void UGList::SetSelectedIndex(int32 Index)
 
 void UGList::SetSelectionController(UGController* InController)
 {
+    if (SelectionController != nullptr)
+        SelectionController->RemoveSubscriber(this);
     SelectionController = InController;
+    if (SelectionController != nullptr)
+        SelectionController->AddSubscriber(this);
 }
 
 void UGList::GetSelection(TArray<int32>& OutIndice) const
@@ -258,21 +268,24 @@ void UGList::GetSelection(TArray<int32>& OutIndice) const
     OutIndice.Reset();
     if (bVirtual)
     {
-        int32 cnt = RealNumItems;
-        for (int32 i = 0; i < cnt; i++)
+        for (TConstSetBitIterator<> It(ItemSelected); It; ++It)
         {
-            const FItemInfo& ii = VirtualItems[i];
-            if ((Cast<UGButton>(ii.Obj) && ((UGButton*)ii.Obj)->IsSelected()) || (ii.Obj == nullptr && ii.bSelected))
-            {
-                int32 j = i;
-                if (bLoop)
-                {
-                    j = i % NumItems;
-                    if (OutIndice.Contains(j))
-                        continue;
-                }
-                OutIndice.Add(j);
-            }
+            if (!ItemObjects.Contains(It.GetIndex()))
+                OutIndice.Add(It.GetIndex());
+        }
+        for (auto& it : ItemObjects)
+        {
+            if (it.Key < RealNumItems && IsItemSelected(it.Key))
+                OutIndice.Add(it.Key);
+        }
+        OutIndice.Sort();
+
+        if (bLoop)
+        {
+            TArray<int32> indice = MoveTemp(OutIndice);
+            OutIndice.Reset();
+            for (int32 i : indice)
+                OutIndice.AddUnique(i % NumItems);
         }
     }
     else
@@ -304,10 +317,8 @@ void UGList::AddSelection(int32 Index, bool bScrollItToView)
     UGButton* Obj = nullptr;
     if (bVirtual)
     {
-        FItemInfo& ii = VirtualItems[Index];
-        if (ii.Obj != nullptr)
-            Obj = ii.Obj->As<UGButton>();
-        ii.bSelected = true;
+        Obj = Cast<UGButton>(GetItemObject(Index));
+        ItemSelected[Index] = true;
     }
     else
         Obj = GetChildAt(Index)->As<UGButton>();
@@ -327,10 +338,8 @@ void UGList::RemoveSelection(int32 Index)
     UGButton* Obj = nullptr;
     if (bVirtual)
     {
-        FItemInfo& ii = VirtualItems[Index];
-        if (ii.Obj != nullptr)
-            Obj = ii.Obj->As<UGButton>();
-        ii.bSelected = false;
+        Obj = Cast<UGButton>(GetItemObject(Index));
+        ItemSelected[Index] = false;
     }
     else
         Obj = GetChildAt(Index)->As<UGButton>();
@@ -343,13 +352,12 @@ void UGList::ClearSelection()
 {
     if (bVirtual)
     {
-        int32 cnt = RealNumItems;
-        for (int32 i = 0; i < cnt; i++)
+        ItemSelected.SetRange(0, ItemSelected.Num(), false);
+        for (auto& it : ItemObjects)
         {
-            FItemInfo& ii = VirtualItems[i];
-            if (Cast<UGButton>(ii.Obj))
-                ((UGButton*)ii.Obj)->SetSelected(false);
-            ii.bSelected = false;
+            UGButton* Obj = Cast<UGButton>(it.Value.Obj);
+            if (Obj != nullptr && it.Key < RealNumItems)
+                Obj->SetSelected(false);
         }
     }
     else
@@ -368,16 +376,12 @@ void UGList::ClearSelectionExcept(UGObject* Obj)
 {
     if (bVirtual)
     {
-        int32 cnt = RealNumItems;
-        for (int32 i = 0; i < cnt; i++)
+        ItemSelected.SetRange(0, ItemSelected.Num(), false);
+        for (auto& it : ItemObjects)
         {
-            FItemInfo& ii = VirtualItems[i];
-            if (ii.Obj != Obj)
-            {
-                if (Cast<UGButton>(ii.Obj))
-                    ((UGButton*)ii.Obj)->SetSelected(false);
-                ii.bSelected = false;
-            }
+            UGButton* Child = Cast<UGButton>(it.Value.Obj);
+            if (Child != nullptr && Child != Obj && it.Key < RealNumItems)
+                Child->SetSelected(false);
         }
     }
     else
@@ -399,16 +403,15 @@ void UGList::SelectAll()
     int32 last = -1;
     if (bVirtual)
     {
-        int32 cnt = RealNumItems;
-        for (int32 i = 0; i < cnt; i++)
+        ItemSelected.SetRange(0, ItemSelected.Num(), true);
+        for (auto& it : ItemObjects)
         {
-            FItemInfo& ii = VirtualItems[i];
-            if (Cast<UGButton>(ii.Obj) && !((UGButton*)ii.Obj)->IsSelected())
+            UGButton* Obj = Cast<UGButton>(it.Value.Obj);
+            if (Obj != nullptr && it.Key < RealNumItems && !Obj->IsSelected())
             {
-                ((UGButton*)ii.Obj)->SetSelected(true);
-                last = i;
+                Obj->SetSelected(true);
+                last = FMath::Max(last, it.Key);
             }
-            ii.bSelected = true;
         }
     }
     else
@@ -436,17 +439,16 @@ void UGList::SelectReverse()
     int32 last = -1;
     if (bVirtual)
     {
-        int32 cnt = RealNumItems;
-        for (int32 i = 0; i < cnt; i++)
+        ItemSelected.BitwiseNOT();
+        for (auto& it : ItemObjects)
         {
-            FItemInfo& ii = VirtualItems[i];
-            if (Cast<UGButton>(ii.Obj))
+            UGButton* Obj = Cast<UGButton>(it.Value.Obj);
+            if (Obj != nullptr && it.Key < RealNumItems)
             {
-                ((UGButton*)ii.Obj)->SetSelected(!((UGButton*)ii.Obj)->IsSelected());
-                if (((UGButton*)ii.Obj)->IsSelected())
-                    last = i;
+                Obj->SetSelected(!Obj->IsSelected());
+                if (Obj->IsSelected())
+                    last = FMath::Max(last, it.Key);
             }
-            ii.bSelected = !ii.bSelected;
         }
     }
     else
@@ -676,12 +678,12 @@ void UGList::SetSelectionOnEvent(UGObject* Obj, UEventContext* Context)
                     max = FMath::Min(max, GetNumItems() - 1);
                     if (bVirtual)
                     {
-                        for (int32 i = min; i <= max; i++)
+                        ItemSelected.SetRange(min, max - min + 1, true);
+                        for (auto& it : ItemObjects)
                         {
-                            FItemInfo& ii = VirtualItems[i];
-                            if (ii.Obj != nullptr && ii.Obj->IsA<UGButton>())
-                                Cast<UGButton>(ii.Obj)->SetSelected(true);
-                            ii.bSelected = true;
+                            UGButton* Child = Cast<UGButton>(it.Value.Obj);
+                            if (Child != nullptr && it.Key >= min && it.Key <= max)
+                                Child->SetSelected(true);
                         }
                     }
                     else
@@ -829,35 +831,33 @@ void UGList::ScrollToView(int32 Index, bool bAnimation, bool bSetFirst)
 
         CheckVirtualList();
 
-        verifyf(Index >= 0 && Index < VirtualItems.Num(), TEXT("Invalid child index"));
+        verifyf(Index >= 0 && Index < ItemSizes.Num(), TEXT("Invalid child index"));
 
         if (bLoop)
             Index = FMath::FloorToFloat((float)FirstIndex / (float)NumItems) * NumItems + Index;
 
         FBox2D rect;
-        FItemInfo& ii = VirtualItems[Index];
+        FVector2D size(ItemSizes[Index]);
         if (Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal)
         {
-            float pos = 0;
-            for (int32 i = CurLineItemCount - 1; i < Index; i += CurLineItemCount)
-                pos += VirtualItems[i].Size.Y + LineGap;
+            UpdateLineIndex();
+            float pos = LineIndex.GetPrefixSum(Index / CurLineItemCount);
             rect.Min.Set(0, pos);
-            rect.Max = rect.Min + FVector2D(ItemSize.X, ii.Size.Y);
+            rect.Max = rect.Min + FVector2D(ItemSize.X, size.Y);
         }
         else if (Layout == EListLayoutType::SingleRow || Layout == EListLayoutType::FlowVertical)
         {
-            float pos = 0;
-            for (int32 i = CurLineItemCount - 1; i < Index; i += CurLineItemCount)
-                pos += VirtualItems[i].Size.X + ColumnGap;
+            UpdateLineIndex();
+            float pos = LineIndex.GetPrefixSum(Index / CurLineItemCount);
             rect.Min.Set(pos, 0);
-            rect.Max = rect.Min + FVector2D(ii.Size.X, ItemSize.Y);
+            rect.Max = rect.Min + FVector2D(size.X, ItemSize.Y);
         }
         else
         {
             int32 page = Index / (CurLineItemCount * CurLineItemCount2);
-            rect.Min.Set(page * GetViewWidth() + (Index % CurLineItemCount) * (ii.Size.X + ColumnGap),
-                (Index / CurLineItemCount) % CurLineItemCount2 * (ii.Size.Y + LineGap));
-            rect.Max = rect.Min + ii.Size;
+            rect.Min.Set(page * GetViewWidth() + (Index % CurLineItemCount) * (size.X + ColumnGap),
+                (Index / CurLineItemCount) % CurLineItemCount2 * (size.Y + LineGap));
+            rect.Max = rect.Min + size;
         }
 
         if (ScrollPane != nullptr)
@@ -886,17 +886,20 @@ int32 UGList::ChildIndexToItemIndex(int32 Index) const
 
     if (Layout == EListLayoutType::Pagination)
     {
-        for (int32 i = FirstIndex; i < RealNumItems; i++)
+        TArray<int32, TInlineAllocator<64>> indice;
+        for (auto& it : ItemObjects)
         {
-            if (VirtualItems[i].Obj != nullptr)
-            {
-                Index--;
-                if (Index < 0)
-                    return i;
-            }
+            if (it.Key >= FirstIndex && it.Key < RealNumItems)
+                indice.Add(it.Key);
         }
 
-        return Index;
+        if (Index < indice.Num())
+        {
+            indice.Sort();
+            return indice[Index];
+        }
+
+        return Index - indice.Num();
     }
     else
     {
@@ -915,7 +918,7 @@ int32 UGList::ItemIndexToChildIndex(int32 Index) const
 
     if (Layout == EListLayoutType::Pagination)
     {
-        return GetChildIndex(VirtualItems[Index].Obj);
+        return GetChildIndex(GetItemObject(Index));
     }
     else
     {
@@ -1020,22 +1023,17 @@ void UGList::SetNumItems(int32 InNumItems)
         else
             RealNumItems = NumItems;
 
-        int32 oldCount = VirtualItems.Num();
+        int32 oldCount = ItemSizes.Num();
         if (RealNumItems > oldCount)
         {
+            ItemSizes.SetNumUninitialized(RealNumItems);
+            FVector2f size(ItemSize);
             for (int32 i = oldCount; i < RealNumItems; i++)
-            {
-                FItemInfo ii;
-                ii.Size = ItemSize;
-
-                VirtualItems.Add(MoveTemp(ii));
-            }
-        }
-        else
-        {
-            for (int32 i = RealNumItems; i < oldCount; i++)
-                VirtualItems[i].bSelected = false;
+                ItemSizes[i] = size;
         }
+        ItemSelected.SetNum(RealNumItems, false);
+
+        bLineIndexDirty = true;
 
         if (VirtualListChanged != 0)
             GetApp()->CancelDelayCall(RefreshTimerHandle);
@@ -1082,21 +1080,21 @@ FVector2D UGList::GetSnappingPosition(const FVector2D& InPoint)
         FVector2f ret = FVector2f(InPoint);
         if (Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal)
         {
-            int32 index = GetIndexOnPos1(ret.Y, false);
-            if (index < VirtualItems.Num() && InPoint.Y - ret.Y > VirtualItems[index].Size.Y / 2 && index < RealNumItems)
-                ret.Y += VirtualItems[index].Size.Y + LineGap;
+            int32 index = GetIndexOnPos1(ret.Y);
+            if (index < ItemSizes.Num() && InPoint.Y - ret.Y > ItemSizes[index].Y / 2 && index < RealNumItems)
+                ret.Y += ItemSizes[index].Y + LineGap;
         }
         else if (Layout == EListLayoutType::SingleRow || Layout == EListLayoutType::FlowVertical)
         {
-            int32 index = GetIndexOnPos2(ret.X, false);
-            if (index < VirtualItems.Num() && InPoint.X - ret.X > VirtualItems[index].Size.X / 2 && index < RealNumItems)
-                ret.X += VirtualItems[index].Size.X + ColumnGap;
+            int32 index = GetIndexOnPos2(ret.X);
+            if (index < ItemSizes.Num() && InPoint.X - ret.X > ItemSizes[index].X / 2 && index < RealNumItems)
+                ret.X += ItemSizes[index].X + ColumnGap;
         }
         else
         {
-            int32 index = GetIndexOnPos3(ret.X, false);
-            if (index < VirtualItems.Num() && InPoint.X - ret.X > VirtualItems[index].Size.X / 2 && index < RealNumItems)
-                ret.X += VirtualItems[index].Size.X + ColumnGap;
+            int32 index = GetIndexOnPos3(ret.X);
+            if (index < ItemSizes.Num() && InPoint.X - ret.X > ItemSizes[index].X / 2 && index < RealNumItems)
+                ret.X += ItemSizes[index].X + ColumnGap;
         }
 
         return FVector2D(ret);
@@ -1176,7 +1174,11 @@ void UGList::DoRefreshVirtualList()
                     CurLineItemCount2 = 1;
             }
         }
+
+        bLineIndexDirty = true;
     }
+    UpdateLineIndex();
+
     float ch = 0, cw = 0;
     if (RealNumItems > 0)
     {
@@ -1184,8 +1186,7 @@ void UGList::DoRefreshVirtualList()
         int32 len2 = FMath::Min(CurLineItemCount, RealNumItems);
         if (Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal)
         {
-            for (int32 i = 0; i < len; i += CurLineItemCount)
-                ch += VirtualItems[i].Size.Y + LineGap;
+            ch = LineIndex.GetTotal();
             if (ch > 0)
                 ch -= LineGap;
 
@@ -1194,15 +1195,14 @@ void UGList::DoRefreshVirtualList()
             else
             {
                 for (int32 i = 0; i < len2; i++)
-                    cw += VirtualItems[i].Size.X + ColumnGap;
+                    cw += ItemSizes[i].X + ColumnGap;
                 if (cw > 0)
                     cw -= ColumnGap;
             }
         }
         else if (Layout == EListLayoutType::SingleRow || Layout == EListLayoutType::FlowVertical)
         {
-            for (int32 i = 0; i < len; i += CurLineItemCount)
-                cw += VirtualItems[i].Size.X + ColumnGap;
+            cw = LineIndex.GetTotal();
             if (cw > 0)
                 cw -= ColumnGap;
 
@@ -1211,7 +1211,7 @@ void UGList::DoRefreshVirtualList()
             else
             {
                 for (int32 i = 0; i < len2; i++)
-                    ch += VirtualItems[i].Size.Y + LineGap;
+                    ch += ItemSizes[i].Y + LineGap;
                 if (ch > 0)
                     ch -= LineGap;
             }
@@ -1237,7 +1237,63 @@ void UGList::OnScrollHandler(UEventContext* Context)
     HandleScroll(false);
 }
 
-int32 UGList::GetIndexOnPos1(float& pos, bool forceUpdate)
+UGObject* UGList::GetItemObject(int32 ItemIndex) const
+{
+    const FItemObject* io = ItemObjects.Find(ItemIndex);
+    return io != nullptr ? io->Obj : nullptr;
+}
+
+UGObject* UGList::DetachItemObject(int32 ItemIndex)
+{
+    FItemObject io;
+    if (!ItemObjects.RemoveAndCopyValue(ItemIndex, io))
+        return nullptr;
+
+    //the button holds the selection while it is alive, hand it back to the bitset
+    if (Cast<UGButton>(io.Obj) && ItemIndex < ItemSelected.Num())
+        ItemSelected[ItemIndex] = ((UGButton*)io.Obj)->IsSelected();
+    return io.Obj;
+}
+
+bool UGList::IsItemSelected(int32 ItemIndex) const
+{
+    if (const FItemObject* io = ItemObjects.Find(ItemIndex))
+        return Cast<UGButton>(io->Obj) && ((UGButton*)io->Obj)->IsSelected();
+    else
+        return ItemSelected[ItemIndex];
+}
+
+void UGList::UpdateLineIndex()
+{
+    if (!bLineIndexDirty)
+        return;
+
+    bLineIndexDirty = false;
+    int32 lineCount = CurLineItemCount > 0 ? FMath::DivideAndRoundUp(RealNumItems, CurLineItemCount) : 0;
+    if (Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal)
+        LineIndex.Build(lineCount, [this](int32 line) { return ItemSizes[line * CurLineItemCount].Y + LineGap; });
+    else if (Layout == EListLayoutType::SingleRow || Layout == EListLayoutType::FlowVertical)
+        LineIndex.Build(lineCount, [this](int32 line) { return ItemSizes[line * CurLineItemCount].X + ColumnGap; });
+    else
+        LineIndex.Reset();
+}
+
+void UGList::UpdateLineSize(int32 ItemIndex)
+{
+    if (bLineIndexDirty || ItemIndex % CurLineItemCount != 0)
+        return;
+
+    int32 line = ItemIndex / CurLineItemCount;
+    if (line >= LineIndex.Num())
+        return;
+
+    if (Layout == EListLayoutType::SingleColumn || Layout == EListLayoutType::FlowHorizontal)
+        LineIndex.SetValue(line, ItemSizes[ItemIndex].Y + LineGap);
+    else
+        LineIndex.SetValue(line, ItemSizes[ItemIndex].X + ColumnGap);
+}
+
+int32 UGList::GetIndexOnPos1(float& pos)
 {
     if (RealNumItems < CurLineItemCount)
     {
@@ -1245,63 +1301,21 @@ int32 UGList::GetIndexOnPos1(float& pos, bool forceUpdate)
         return 0;
     }
 
-    if (NumChildren() > 0 && !forceUpdate)
-    {
-        float pos2 = GetChildAt(0)->GetY();
-        if (pos2 + (LineGap > 0 ? 0 : -LineGap) > pos)
-        {
-            for (int32 i = FirstIndex - CurLineItemCount; i >= 0; i -= CurLineItemCount)
-            {
-                pos2 -= (VirtualItems[i].Size.Y + LineGap);
-                if (pos2 <= pos)
-                {
-                    pos = pos2;
-                    return i;
-                }
-            }
-
-            pos = 0;
-            return 0;
-        }
-        else
-        {
-            float testGap = LineGap > 0 ? LineGap : 0;
-            for (int32 i = FirstIndex; i < RealNumItems; i += CurLineItemCount)
-            {
-                float pos3 = pos2 + VirtualItems[i].Size.Y;
-                if (pos3 + testGap > pos)
-                {
-                    pos = pos2;
-                    return i;
-                }
-                pos2 = pos3 + LineGap;
-            }
+    UpdateLineIndex();
 
-            pos = pos2;
-            return RealNumItems - CurLineItemCount;
-        }
-    }
-    else
+    //the first line whose bottom edge, including a positive gap, is below pos
+    int32 line = LineIndex.FindCount(pos + FMath::Min(LineGap, 0));
+    if (line >= LineIndex.Num())
     {
-        float pos2 = 0;
-        float testGap = LineGap > 0 ? LineGap : 0;
-        for (int32 i = 0; i < RealNumItems; i += CurLineItemCount)
-        {
-            float pos3 = pos2 + VirtualItems[i].Size.Y;
-            if (pos3 + testGap > pos)
-            {
-                pos = pos2;
-                return i;
-            }
-            pos2 = pos3 + LineGap;
-        }
-
-        pos = pos2;
+        pos = LineIndex.GetTotal();
         return RealNumItems - CurLineItemCount;
     }
+
+    pos = LineIndex.GetPrefixSum(line);
+    return line * CurLineItemCount;
 }
 
-int32 UGList::GetIndexOnPos2(float& pos, bool forceUpdate)
+int32 UGList::GetIndexOnPos2(float& pos)
 {
     if (RealNumItems < CurLineItemCount)
     {
@@ -1309,63 +1323,20 @@ int32 UGList::GetIndexOnPos2(float& pos, bool forceUpdate)
         return 0;
     }
 
-    if (NumChildren() > 0 && !forceUpdate)
-    {
-        float pos2 = GetChildAt(0)->GetX();
-        if (pos2 + (ColumnGap > 0 ? 0 : -ColumnGap) > pos)
-        {
-            for (int32 i = FirstIndex - CurLineItemCount; i >= 0; i -= CurLineItemCount)
-            {
-                pos2 -= (VirtualItems[i].Size.X + ColumnGap);
-                if (pos2 <= pos)
-                {
-                    pos = pos2;
-                    return i;
-                }
-            }
-
-            pos = 0;
-            return 0;
-        }
-        else
-        {
-            float testGap = ColumnGap > 0 ? ColumnGap : 0;
-            for (int32 i = FirstIndex; i < RealNumItems; i += CurLineItemCount)
-            {
-                float pos3 = pos2 + VirtualItems[i].Size.X;
-                if (pos3 + testGap > pos)
-                {
-                    pos = pos2;
-                    return i;
-                }
-                pos2 = pos3 + ColumnGap;
-            }
+    UpdateLineIndex();
 
-            pos = pos2;
-            return RealNumItems - CurLineItemCount;
-        }
-    }
-    else
+    int32 line = LineIndex.FindCount(pos + FMath::Min(ColumnGap, 0));
+    if (line >= LineIndex.Num())
     {
-        float pos2 = 0;
-        float testGap = ColumnGap > 0 ? ColumnGap : 0;
-        for (int32 i = 0; i < RealNumItems; i += CurLineItemCount)
-        {
-            float pos3 = pos2 + VirtualItems[i].Size.X;
-            if (pos3 + testGap > pos)
-            {
-                pos = pos2;
-                return i;
-            }
-            pos2 = pos3 + ColumnGap;
-        }
-
-        pos = pos2;
+        pos = LineIndex.GetTotal();
         return RealNumItems - CurLineItemCount;
     }
+
+    pos = LineIndex.GetPrefixSum(line);
+    return line * CurLineItemCount;
 }
 
-int32 UGList::GetIndexOnPos3(float& pos, bool forceUpdate)
+int32 UGList::GetIndexOnPos3(float& pos)
 {
     if (RealNumItems < CurLineItemCount)
     {
@@ -1380,7 +1351,7 @@ int32 UGList::GetIndexOnPos3(float& pos, bool forceUpdate)
     float testGap = ColumnGap > 0 ? ColumnGap : 0;
     for (int32 i = 0; i < CurLineItemCount; i++)
     {
-        float pos3 = pos2 + VirtualItems[startIndex + i].Size.X;
+        float pos3 = pos2 + ItemSizes[startIndex + i].X;
         if (pos3 + testGap > pos)
         {
             pos = pos2;
@@ -1442,7 +1413,7 @@ bool UGList::HandleScroll1(bool forceUpdate)
     float max = pos + ScrollPane->GetViewSize().Y;
     bool end = max == ScrollPane->GetContentSize().Y;
 
-    int32 newFirstIndex = GetIndexOnPos1(pos, forceUpdate);
+    int32 newFirstIndex = GetIndexOnPos1(pos);
     if (newFirstIndex == FirstIndex && !forceUpdate)
         return false;
 
@@ -1463,9 +1434,10 @@ bool UGList::HandleScroll1(bool forceUpdate)
     ItemInfoVer++;
     while (curIndex < RealNumItems && (end || curY < max))
     {
-        FItemInfo& ii = VirtualItems[curIndex];
+        FItemObject* io = ItemObjects.Find(curIndex);
+        UGObject* obj = io != nullptr ? io->Obj : nullptr;
 
-        if (ii.Obj == nullptr || forceUpdate)
+        if (obj == nullptr || forceUpdate)
         {
             if (ItemProvider.IsBound())
             {
@@ -1475,28 +1447,24 @@ bool UGList::HandleScroll1(bool forceUpdate)
                 url = UUIPackage::NormalizeURL(url);
             }
 
-            if (ii.Obj != nullptr && ii.Obj->GetResourceURL().Compare(url) != 0)
+            if (obj != nullptr && obj->GetResourceURL().Compare(url) != 0)
             {
-                if (Cast<UGButton>(ii.Obj))
-                    ii.bSelected = ((UGButton*)ii.Obj)->IsSelected();
-                RemoveChildToPool(ii.Obj);
-                ii.Obj = nullptr;
+                RemoveChildToPool(DetachItemObject(curIndex));
+                obj = nullptr;
+                io = nullptr;
             }
         }
 
-        if (ii.Obj == nullptr)
+        if (obj == nullptr)
         {
             if (forward)
             {
                 for (int32 j = reuseIndex; j >= oldFirstIndex; j--)
                 {
-                    FItemInfo& ii2 = VirtualItems[j];
-                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceURL().Compare(url) == 0)
+                    const FItemObject* io = ItemObjects.Find(j);
+                    if (io != nullptr && io->UpdateFlag != ItemInfoVer && io->Obj->GetResourceURL().Compare(url) == 0)
                     {
-                        if (Cast<UGButton>(ii2.Obj))
-                            ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
-                        ii.Obj = ii2.Obj;
-                        ii2.Obj = nullptr;
+                        obj = DetachItemObject(j);
                         if (j == reuseIndex)
                             reuseIndex--;
                         break;
@@ -1507,13 +1475,10 @@ bool UGList::HandleScroll1(bool forceUpdate)
             {
                 for (int32 j = reuseIndex; j <= lastIndex; j++)
                 {
-                    FItemInfo& ii2 = VirtualItems[j];
-                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceURL().Compare(url) == 0)
+                    const FItemObject* io = ItemObjects.Find(j);
+                    if (io != nullptr && io->UpdateFlag != ItemInfoVer && io->Obj->GetResourceURL().Compare(url) == 0)
                     {
-                        if (Cast<UGButton>(ii2.Obj))
-                            ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
-                        ii.Obj = ii2.Obj;
-                        ii2.Obj = nullptr;
+                        obj = DetachItemObject(j);
                         if (j == reuseIndex)
                             reuseIndex++;
                         break;
@@ -1521,75 +1486,74 @@ bool UGList::HandleScroll1(bool forceUpdate)
                 }
             }
 
-            if (ii.Obj != nullptr)
+            if (obj != nullptr)
             {
-                SetChildIndex(ii.Obj, forward ? curIndex - newFirstIndex : NumChildren());
+                SetChildIndex(obj, forward ? curIndex - newFirstIndex : NumChildren());
             }
             else
             {
-                ii.Obj = Pool->GetObject(url, this);
+                obj = Pool->GetObject(url, this);
                 if (forward)
-                    AddChildAt(ii.Obj, curIndex - newFirstIndex);
+                    AddChildAt(obj, curIndex - newFirstIndex);
                 else
-                    AddChild(ii.Obj);
+                    AddChild(obj);
             }
-            if (Cast<UGButton>(ii.Obj))
-                ((UGButton*)ii.Obj)->SetSelected(ii.bSelected);
+            if (Cast<UGButton>(obj))
+                ((UGButton*)obj)->SetSelected(ItemSelected[curIndex]);
 
+            ItemObjects.Add(curIndex, { obj, ItemInfoVer });
             needRender = true;
         }
         else
+        {
+            io->UpdateFlag = ItemInfoVer;
             needRender = forceUpdate;
+        }
 
         if (needRender)
         {
             if (bAutoResizeItem && (Layout == EListLayoutType::SingleColumn || ColumnCount > 0))
-                ii.Obj->SetSize(FVector2D(partSize, ii.Obj->GetHeight()), true);
+                obj->SetSize(FVector2D(partSize, obj->GetHeight()), true);
 
-            ItemRenderer.ExecuteIfBound(curIndex % NumItems, ii.Obj);
+            ItemRenderer.ExecuteIfBound(curIndex % NumItems, obj);
             if (curIndex % CurLineItemCount == 0)
             {
-                deltaSize += FMath::CeilToFloat(ii.Obj->GetHeight()) - ii.Size.Y;
+                deltaSize += FMath::CeilToFloat(obj->GetHeight()) - ItemSizes[curIndex].Y;
                 if (curIndex == newFirstIndex && oldFirstIndex > newFirstIndex)
                 {
-                    firstItemDeltaSize = FMath::CeilToFloat(ii.Obj->GetHeight()) - ii.Size.Y;
+                    firstItemDeltaSize = FMath::CeilToFloat(obj->GetHeight()) - ItemSizes[curIndex].Y;
                 }
             }
-            ii.Size.X = FMath::CeilToFloat(ii.Obj->GetWidth());
-            ii.Size.Y = FMath::CeilToFloat(ii.Obj->GetHeight());
+            ItemSizes[curIndex].Set(FMath::CeilToFloat(obj->GetWidth()), FMath::CeilToFloat(obj->GetHeight()));
+            UpdateLineSize(curIndex);
         }
 
-        ii.UpdateFlag = ItemInfoVer;
-        ii.Obj->SetPosition(FVector2D(curX, curY));
+        const FVector2f& size = ItemSizes[curIndex];
+        obj->SetPosition(FVector2D(curX, curY));
         if (curIndex == newFirstIndex)
-            max += ii.Size.Y;
+            max += size.Y;
 
-        curX += ii.Size.X + ColumnGap;
+        curX += size.X + ColumnGap;
 
         if (curIndex % CurLineItemCount == CurLineItemCount - 1)
         {
             curX = 0;
-            curY += ii.Size.Y + LineGap;
+            curY += size.Y + LineGap;
         }
         curIndex++;
     }
 
     for (int32 i = 0; i < childCount; i++)
     {
-        FItemInfo& ii = VirtualItems[oldFirstIndex + i];
-        if (ii.UpdateFlag != ItemInfoVer && ii.Obj != nullptr)
-        {
-            if (Cast<UGButton>(ii.Obj))
-                ii.bSelected = ((UGButton*)ii.Obj)->IsSelected();
-            RemoveChildToPool(ii.Obj);
-            ii.Obj = nullptr;
-        }
+        const FItemObject* io = ItemObjects.Find(oldFirstIndex + i);
+        if (io != nullptr && io->UpdateFlag != ItemInfoVer)
+            RemoveChildToPool(DetachItemObject(oldFirstIndex + i));
     }
 
     childCount = Children.Num();
     for (int32 i = 0; i < childCount; i++)
     {
-        UGObject* obj = VirtualItems[newFirstIndex + i].Obj;
+        UGObject* obj = GetItemObject(newFirstIndex + i);
         if (Children[i] != obj)
             SetChildIndex(obj, i);
     }
@@ -1609,7 +1573,7 @@ bool UGList::HandleScroll2(bool forceUpdate)
     float max = pos + ScrollPane->GetViewSize().X;
     bool end = pos == ScrollPane->GetContentSize().X;
 
-    int32 newFirstIndex = GetIndexOnPos2(pos, forceUpdate);
+    int32 newFirstIndex = GetIndexOnPos2(pos);
     if (newFirstIndex == FirstIndex && !forceUpdate)
         return false;
 
@@ -1630,9 +1594,10 @@ bool UGList::HandleScroll2(bool forceUpdate)
     ItemInfoVer++;
     while (curIndex < RealNumItems && (end || curX < max))
     {
-        FItemInfo& ii = VirtualItems[curIndex];
+        FItemObject* io = ItemObjects.Find(curIndex);
+        UGObject* obj = io != nullptr ? io->Obj : nullptr;
 
-        if (ii.Obj == nullptr || forceUpdate)
+        if (obj == nullptr || forceUpdate)
         {
             if (ItemProvider.IsBound())
             {
@@ -1642,28 +1607,24 @@ bool UGList::HandleScroll2(bool forceUpdate)
                 url = UUIPackage::NormalizeURL(url);
             }
 
-            if (ii.Obj != nullptr && ii.Obj->GetResourceURL().Compare(url) != 0)
+            if (obj != nullptr && obj->GetResourceURL().Compare(url) != 0)
             {
-                if (Cast<UGButton>(ii.Obj))
-                    ii.bSelected = ((UGButton*)ii.Obj)->IsSelected();
-                RemoveChildToPool(ii.Obj);
-                ii.Obj = nullptr;
+                RemoveChildToPool(DetachItemObject(curIndex));
+                obj = nullptr;
+                io = nullptr;
             }
         }
 
-        if (ii.Obj == nullptr)
+        if (obj == nullptr)
         {
             if (forward)
             {
                 for (int32 j = reuseIndex; j >= oldFirstIndex; j--)
                 {
-                    FItemInfo& ii2 = VirtualItems[j];
-                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceURL().Compare(url) == 0)
+                    const FItemObject* io = ItemObjects.Find(j);
+                    if (io != nullptr && io->UpdateFlag != ItemInfoVer && io->Obj->GetResourceURL().Compare(url) == 0)
                     {
-                        if (Cast<UGButton>(ii2.Obj))
-                            ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
-                        ii.Obj = ii2.Obj;
-                        ii2.Obj = nullptr;
+                        obj = DetachItemObject(j);
                         if (j == reuseIndex)
                             reuseIndex--;
                         break;
@@ -1674,13 +1635,10 @@ bool UGList::HandleScroll2(bool forceUpdate)
             {
                 for (int32 j = reuseIndex; j <= lastIndex; j++)
                 {
-                    FItemInfo& ii2 = VirtualItems[j];
-                    if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer && ii2.Obj->GetResourceURL().Compare(url) == 0)
+                    const FItemObject* io = ItemObjects.Find(j);
+                    if (io != nullptr && io->UpdateFlag != ItemInfoVer && io->Obj->GetResourceURL().Compare(url) == 0)
                     {
-                        if (Cast<UGButton>(ii2.Obj))
-                            ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
-                        ii.Obj = ii2.Obj;
-                        ii2.Obj = nullptr;
+                        obj = DetachItemObject(j);
                         if (j == reuseIndex)
                             reuseIndex++;
                         break;
@@ -1688,75 +1646,74 @@ bool UGList::HandleScroll2(bool forceUpdate)
                 }
             }
 
-            if (ii.Obj != nullptr)
+            if (obj != nullptr)
             {
-                SetChildIndex(ii.Obj, forward ? curIndex - newFirstIndex : NumChildren());
+                SetChildIndex(obj, forward ? curIndex - newFirstIndex : NumChildren());
             }
             else
             {
-                ii.Obj = Pool->GetObject(url, this);
+                obj = Pool->GetObject(url, this);
                 if (forward)
-                    AddChildAt(ii.Obj, curIndex - newFirstIndex);
+                    AddChildAt(obj, curIndex - newFirstIndex);
                 else
-                    AddChild(ii.Obj);
+                    AddChild(obj);
             }
-            if (Cast<UGButton>(ii.Obj))
-                ((UGButton*)ii.Obj)->SetSelected(ii.bSelected);
+            if (Cast<UGButton>(obj))
+                ((UGButton*)obj)->SetSelected(ItemSelected[curIndex]);
 
+            ItemObjects.Add(curIndex, { obj, ItemInfoVer });
             needRender = true;
         }
         else
+        {
+            io->UpdateFlag = ItemInfoVer;
             needRender = forceUpdate;
+        }
 
         if (needRender)
         {
             if (bAutoResizeItem && (Layout == EListLayoutType::SingleRow || LineCount > 0))
-                ii.Obj->SetSize(FVector2D(ii.Obj->GetWidth(), partSize), true);
+                obj->SetSize(FVector2D(obj->GetWidth(), partSize), true);
 
-            ItemRenderer.ExecuteIfBound(curIndex % NumItems, ii.Obj);
+            ItemRenderer.ExecuteIfBound(curIndex % NumItems, obj);
             if (curIndex % CurLineItemCount == 0)
             {
-                deltaSize += FMath::CeilToFloat(ii.Obj->GetWidth()) - ii.Size.X;
+                deltaSize += FMath::CeilToFloat(obj->GetWidth()) - ItemSizes[curIndex].X;
                 if (curIndex == newFirstIndex && oldFirstIndex > newFirstIndex)
                 {
-                    firstItemDeltaSize = FMath::CeilToFloat(ii.Obj->GetWidth()) - ii.Size.X;
+                    firstItemDeltaSize = FMath::CeilToFloat(obj->GetWidth()) - ItemSizes[curIndex].X;
                 }
             }
-            ii.Size.X = FMath::CeilToFloat(ii.Obj->GetWidth());
-            ii.Size.Y = FMath::CeilToFloat(ii.Obj->GetHeight());
+            ItemSizes[curIndex].Set(FMath::CeilToFloat(obj->GetWidth()), FMath::CeilToFloat(obj->GetHeight()));
+            UpdateLineSize(curIndex);
         }
 
-        ii.UpdateFlag = ItemInfoVer;
-        ii.Obj->SetPosition(FVector2D(curX, curY));
+        const FVector2f& size = ItemSizes[curIndex];
+        obj->SetPosition(FVector2D(curX, curY));
         if (curIndex == newFirstIndex)
-            max += ii.Size.X;
+            max += size.X;
 
-        curY += ii.Size.Y + LineGap;
+        curY += size.Y + LineGap;
 
         if (curIndex % CurLineItemCount == CurLineItemCount - 1)
         {
             curY = 0;
-            curX += ii.Size.X + ColumnGap;
+            curX += size.X + ColumnGap;
         }
         curIndex++;
     }
 
     for (int32 i = 0; i < childCount; i++)
     {
-        FItemInfo& ii = VirtualItems[oldFirstIndex + i];
-        if (ii.UpdateFlag != ItemInfoVer && ii.Obj != nullptr)
-        {
-            if (Cast<UGButton>(ii.Obj))
-                ii.bSelected = ((UGButton*)ii.Obj)->IsSelected();
-            RemoveChildToPool(ii.Obj);
-            ii.Obj = nullptr;
-        }
+        const FItemObject* io = ItemObjects.Find(oldFirstIndex + i);
+        if (io != nullptr && io->UpdateFlag != ItemInfoVer)
+            RemoveChildToPool(DetachItemObject(oldFirstIndex + i));
     }
 
     childCount = Children.Num();
     for (int32 i = 0; i < childCount; i++)
     {
-        UGObject* obj = VirtualItems[newFirstIndex + i].Obj;
+        UGObject* obj = GetItemObject(newFirstIndex + i);
         if (Children[i] != obj)
             SetChildIndex(obj, i);
     }
@@ -1774,15 +1731,12 @@ void UGList::HandleScroll3(bool forceUpdate)
 {
     float pos = ScrollPane->GetScrollingPosX();
 
-    int32 newFirstIndex = GetIndexOnPos3(pos, forceUpdate);
+    int32 newFirstIndex = GetIndexOnPos3(pos);
     if (newFirstIndex == FirstIndex && !forceUpdate)
         return;
 
-    int32 oldFirstIndex = FirstIndex;
     FirstIndex = newFirstIndex;
 
-    int32 reuseIndex = oldFirstIndex;
-    int32 virtualItemCount = VirtualItems.Num();
     int32 pageSize = CurLineItemCount * CurLineItemCount2;
     int32 startCol = newFirstIndex % CurLineItemCount;
     float viewWidth = GetViewWidth();
@@ -1795,6 +1749,7 @@ void UGList::HandleScroll3(bool forceUpdate)
     int32 partHeight = (int32)((ScrollPane->GetViewSize().Y - LineGap * (CurLineItemCount2 - 1)) / CurLineItemCount2);
     ItemInfoVer++;
 
+    ItemInView.Init(false, lastIndex - startIndex);
     for (int32 i = startIndex; i < lastIndex; i++)
     {
         if (i >= RealNumItems)
@@ -1812,42 +1767,38 @@ void UGList::HandleScroll3(bool forceUpdate)
                 continue;
         }
 
-        FItemInfo& ii = VirtualItems[i];
-        ii.UpdateFlag = ItemInfoVer;
+        ItemInView[i - startIndex] = true;
+        if (FItemObject* io = ItemObjects.Find(i))
+            io->UpdateFlag = ItemInfoVer;
+    }
+
+    //objects of the items that scrolled out, lowest index first
+    TArray<int32, TInlineAllocator<64>> reuseIndice;
+    for (auto& it : ItemObjects)
+    {
+        if (it.Value.UpdateFlag != ItemInfoVer)
+            reuseIndice.Add(it.Key);
     }
+    reuseIndice.Sort();
+    int32 reuseIndex = 0;
 
     UGObject* lastObj = nullptr;
     int32 insertIndex = 0;
     for (int32 i = startIndex; i < lastIndex; i++)
     {
-        if (i >= RealNumItems)
-            continue;
-
-        FItemInfo& ii = VirtualItems[i];
-        if (ii.UpdateFlag != ItemInfoVer)
+        if (i >= RealNumItems || !ItemInView[i - startIndex])
             continue;
 
-        if (ii.Obj == nullptr)
+        UGObject* obj = GetItemObject(i);
+        if (obj == nullptr)
         {
-            reuseIndex = reuseIndex < 0 ? 0 : reuseIndex;
-            while (reuseIndex < virtualItemCount)
-            {
-                FItemInfo& ii2 = VirtualItems[reuseIndex];
-                if (ii2.Obj != nullptr && ii2.UpdateFlag != ItemInfoVer)
-                {
-                    if (Cast<UGButton>(ii2.Obj))
-                        ii2.bSelected = ((UGButton*)ii2.Obj)->IsSelected();
-                    ii.Obj = ii2.Obj;
-                    ii2.Obj = nullptr;
-                    break;
-                }
-                reuseIndex++;
-            }
+            if (reuseIndex < reuseIndice.Num())
+                obj = DetachItemObject(reuseIndice[reuseIndex++]);
 
             if (insertIndex == -1)
                 insertIndex = GetChildIndex(lastObj) + 1;
 
-            if (ii.Obj == nullptr)
+            if (obj == nullptr)
             {
                 if (ItemProvider.IsBound())
                 {
@@ -1857,25 +1808,26 @@ void UGList::HandleScroll3(bool forceUpdate)
                     url = UUIPackage::NormalizeURL(url);
                 }
 
-                ii.Obj = Pool->GetObject(url, this);
-                AddChildAt(ii.Obj, insertIndex);
+                obj = Pool->GetObject(url, this);
+                AddChildAt(obj, insertIndex);
             }
             else
             {
-                insertIndex = SetChildIndexBefore(ii.Obj, insertIndex);
+                insertIndex = SetChildIndexBefore(obj, insertIndex);
             }
             insertIndex++;
 
-            if (Cast<UGButton>(ii.Obj))
-                ((UGButton*)ii.Obj)->SetSelected(ii.bSelected);
+            if (Cast<UGButton>(obj))
+                ((UGButton*)obj)->SetSelected(ItemSelected[i]);
 
+            ItemObjects.Add(i, { obj, ItemInfoVer });
             needRender = true;
         }
         else
         {
             needRender = forceUpdate;
             insertIndex = -1;
-            lastObj = ii.Obj;
+            lastObj = obj;
         }
 
         if (needRender)
@@ -1883,16 +1835,15 @@ void UGList::HandleScroll3(bool forceUpdate)
             if (bAutoResizeItem)
             {
                 if (CurLineItemCount == ColumnCount && CurLineItemCount2 == LineCount)
-                    ii.Obj->SetSize(FVector2D(partWidth, partHeight), true);
+                    obj->SetSize(FVector2D(partWidth, partHeight), true);
                 else if (CurLineItemCount == ColumnCount)
-                    ii.Obj->SetSize(FVector2D(partWidth, ii.Obj->GetHeight()), true);
+                    obj->SetSize(FVector2D(partWidth, obj->GetHeight()), true);
                 else if (CurLineItemCount2 == LineCount)
-                    ii.Obj->SetSize(FVector2D(ii.Obj->GetWidth(), partHeight), true);
+                    obj->SetSize(FVector2D(obj->GetWidth(), partHeight), true);
             }
 
-            ItemRenderer.ExecuteIfBound(i % NumItems, ii.Obj);
-            ii.Size.X = FMath::CeilToFloat(ii.Obj->GetWidth());
-            ii.Size.Y = FMath::CeilToFloat(ii.Obj->GetHeight());
+            ItemRenderer.ExecuteIfBound(i % NumItems, obj);
+            ItemSizes[i].Set(FMath::CeilToFloat(obj->GetWidth()), FMath::CeilToFloat(obj->GetHeight()));
         }
     }
 
@@ -1905,12 +1856,12 @@ void UGList::HandleScroll3(bool forceUpdate)
         if (i >= RealNumItems)
             continue;
 
-        FItemInfo& ii = VirtualItems[i];
-        if (ii.UpdateFlag == ItemInfoVer)
-            ii.Obj->SetPosition(FVector2D(xx, yy));
+        const FVector2f& size = ItemSizes[i];
+        if (ItemInView[i - startIndex])
+            GetItemObject(i)->SetPosition(FVector2D(xx, yy));
 
-        if (ii.Size.Y > lineHeight)
-            lineHeight = ii.Size.Y;
+        if (size.Y > lineHeight)
+            lineHeight = size.Y;
         if (i % CurLineItemCount == CurLineItemCount - 1)
         {
             xx = borderX;
@@ -1925,20 +1876,11 @@ void UGList::HandleScroll3(bool forceUpdate)
             }
         }
         else
-            xx += ii.Size.X + ColumnGap;
+            xx += size.X + ColumnGap;
     }
 
-    for (int32 i = reuseIndex; i < virtualItemCount; i++)
-    {
-        FItemInfo& ii = VirtualItems[i];
-        if (ii.UpdateFlag != ItemInfoVer && ii.Obj != nullptr)
-        {
-            if (Cast<UGButton>(ii.Obj))
-                ii.bSelected = ((UGButton*)ii.Obj)->IsSelected();
-            RemoveChildToPool(ii.Obj);
-            ii.Obj = nullptr;
-        }
-    }
+    for (; reuseIndex < reuseIndice.Num(); reuseIndex++)
+        RemoveChildToPool(DetachItemObject(reuseIndice[reuseIndex]));
 }
 
 void UGList::HandleArchOrder1()
@@ -2513,5 +2455,5 @@ void UGList::SetupAfterAdd(FByteBuffer* Buffer, int32 BeginPos)
 
     int32 i = Buffer->ReadShort();
     if (i != -1)
-        SelectionController = Parent->GetControllerAt(i);
+        SetSelectionController(Parent->GetControllerAt(i));
 }
\ No newline at end of file
@@ -10,12 +10,63 @@
 #include "Widgets/SDisplayObject.h"
 #include "Utils/ByteBuffer.h"
 #include "FairyApplication.h"
+#include "UObject/ObjectKey.h"
 
 TWeakObjectPtr<UGObject> UGObject::DraggingObject;
 FVector2D UGObject::GlobalDragStart;
 FBox2D UGObject::GlobalRect;
 bool UGObject::bUpdateInDragging = false;
 
+//event types past this index share the last bit and are resolved by name
+static constexpr int32 OverflowEventTypeIndex = 63;
+
+struct FEventDelegateTable
+{
+    const FMulticastInlineDelegateProperty* Properties[OverflowEventTypeIndex];
+    TMap<FName, const FMulticastInlineDelegateProperty*> OverflowProperties;
+    uint64 Mask;
+
+    static const FEventDelegateTable& Get(const UClass* Class);
+};
+
+const FEventDelegateTable& FEventDelegateTable::Get(const UClass* Class)
+{
+    static TMap<FObjectKey, TUniquePtr<FEventDelegateTable>> Tables;
+
+    TUniquePtr<FEventDelegateTable>& Table = Tables.FindOrAdd(FObjectKey(Class));
+    if (Table.IsValid())
+        return *Table;
+
+    Table = MakeUnique<FEventDelegateTable>();
+    FMemory::Memzero(Table->Properties);
+    Table->Mask = 0;
+
+    //every On<EventType> delegate with the GUI event signature receives that event
+    static const UFunction* Signature = CastFieldChecked<FMulticastDelegateProperty>(
+        UGObject::StaticClass()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(UGObject, OnClick)))->SignatureFunction;
+
+    for (TFieldIterator<FMulticastInlineDelegateProperty> It(Class); It; ++It)
+    {
+        const FMulticastInlineDelegateProperty* Property = *It;
+        if (Property->SignatureFunction == nullptr || !Property->SignatureFunction->IsSignatureCompatibleWith(Signature))
+            continue;
+
+        const FString PropertyName = Property->GetName();
+        if (PropertyName.Len() <= 2 || !PropertyName.StartsWith(TEXT("On"), ESearchCase::CaseSensitive))
+            continue;
+
+        const FName EventType(*PropertyName + 2);
+        const int32 Index = UGObject::GetEventTypeIndex(EventType);
+        Table->Mask |= 1ull << Index;
+        if (Index < OverflowEventTypeIndex)
+            Table->Properties[Index] = Property;
+        else
+            Table->OverflowProperties.Add(EventType, Property);
+    }
+
+    return *Table;
+}
+
 UGObject::UGObject() :
     SourceSize(ForceInit),
     InitSize(ForceInit),
@@ -29,7 +80,11 @@ UGObject::UGObject() :
     Skew(ForceInit),
     Alpha(1.0f),
     bVisible(true),
-    bInternalVisible(true)
+    bInternalVisible(true),
+    ControllerStamp(0),
+    IndexInGroup(INDEX_NONE),
+    NativeEventMask(0),
+    EventDelegateTable(nullptr)
 {
     static int32 _gInstanceCounter = 1;
     ID.AppendInt(_gInstanceCounter);
@@ -70,7 +125,7 @@ void UGObject::SetPosition(const FVector2D& InPosition)
         {
             Parent->SetBoundsChangedFlag();
             if (Group.IsValid())
-                Group->SetBoundsChangedFlag(true);
+                Group->OnMemberChanged(this, true);
 
             OnPositionChangedEvent.Broadcast();
         }
@@ -149,7 +204,7 @@ void UGObject::SetSize(const FVector2D& InSize, bool bIgnorePivot)
             Relations->OnOwnerSizeChanged(Delta, bPivotAsAnchor || !bIgnorePivot);
             Parent->SetBoundsChangedFlag();
             if (Group.IsValid())
-                Group->SetBoundsChangedFlag();
+                Group->OnMemberChanged(this);
         }
 
         OnSizeChangedEvent.Broadcast();
@@ -231,6 +286,7 @@ void UGObject::UpdateTransform()
     FQuat2D Quat2D = FQuat2D(FMath::DegreesToRadians(Rotation));
     FMatrix2x2 Matrix = Concatenate(Quat2D, Scale2D);
     DisplayObject->SetRenderTransform(FSlateRenderTransform(Matrix, Position));
+    DisplayObject->InvalidatePaintBounds();
 }
 
 void UGObject::SetAlpha(float InAlpha)
@@ -262,7 +318,7 @@ void UGObject::SetVisible(bool bInVisible)
         if (Parent.IsValid())
             Parent->SetBoundsChangedFlag();
         if (Group.IsValid() && Group->IsExcludeInvisibles())
-            Group->SetBoundsChangedFlag();
+            Group->OnMemberChanged(this);
     }
 }
 
@@ -309,10 +365,16 @@ void UGObject::SetGroup(UGGroup* InGroup)
     if (Group.Get() != InGroup)
     {
         if (Group.IsValid())
+        {
+            Group->InvalidateMembers();
             Group->SetBoundsChangedFlag();
+        }
         Group = InGroup;
         if (Group.IsValid())
+        {
+            Group->InvalidateMembers();
             Group->SetBoundsChangedFlag();
+        }
         HandleVisibleChanged();
         if (Parent.IsValid())
             Parent->ChildStateChanged(this);
@@ -548,7 +610,7 @@ void UGObject::CheckGearDisplay()
         if (Parent.IsValid())
             Parent->ChildStateChanged(this);
         if (Group.IsValid() && Group->IsExcludeInvisibles())
-            Group->SetBoundsChangedFlag();
+            Group->OnMemberChanged(this);
     }
 }
 
@@ -630,44 +692,105 @@ bool UGObject::DispatchEvent(const FName& EventType, const FNVariant& Data)
 
 bool UGObject::HasEventListener(const FName& EventType) const
 {
-    const FUnifiedEventDelegate& Delegate = const_cast<UGObject*>(this)->GetEventDelegate(EventType);
-    return Delegate.Func.IsBound() || (Delegate.DynFunc != nullptr && Delegate.DynFunc->IsBound());
+    const int32 Index = GetEventTypeIndex(EventType);
+    const uint64 Bit = 1ull << Index;
+
+    if ((NativeEventMask & Bit) != 0)
+    {
+        FGUIEventMDelegate* Func = FindNativeEventDelegate(EventType);
+        if (Func != nullptr && Func->IsBound())
+            return true;
+    }
+
+    if ((GetEventDelegateTable().Mask & Bit) != 0)
+    {
+        FGUIEventDynMDelegate* DynFunc = FindDynamicEventDelegate(EventType, Index);
+        if (DynFunc != nullptr && DynFunc->IsBound())
+            return true;
+    }
+
+    return false;
 }
 
 void UGObject::InvokeEventDelegate(UEventContext* Context)
 {
-    FUnifiedEventDelegate& Delegate = GetEventDelegate(Context->GetType());
-    Delegate.Func.Broadcast(Context);
-    if (Delegate.DynFunc != nullptr)
-        Delegate.DynFunc->Broadcast(Context);
+    InvokeEventDelegate(Context, GetEventTypeIndex(Context->GetType()));
 }
 
-UGObject::FUnifiedEventDelegate& UGObject::GetEventDelegate(const FName& EventType)
+void UGObject::InvokeEventDelegate(UEventContext* Context, int32 EventTypeIndex)
 {
-    FUnifiedEventDelegate* Delegate = EventDelegates.Find(EventType);
-    if (Delegate == nullptr)
+    const uint64 Bit = 1ull << EventTypeIndex;
+    const FEventDelegateTable& Table = GetEventDelegateTable();
+    if (((NativeEventMask | Table.Mask) & Bit) == 0)
+        return;
+
+    if ((NativeEventMask & Bit) != 0)
     {
-        Delegate = &EventDelegates.Add(EventType);
+        FGUIEventMDelegate* Func = FindNativeEventDelegate(Context->GetType());
+        if (Func != nullptr)
+            Func->Broadcast(Context);
+    }
 
-#if (ENGINE_MAJOR_VERSION <= 4) && (ENGINE_MINOR_VERSION < 25)
-        UProperty
-#else
-        FProperty
-#endif
-            * Property = GetClass()->FindPropertyByName(FName(*FString("On").Append(EventType.ToString())));
+    if ((Table.Mask & Bit) != 0)
+    {
+        FGUIEventDynMDelegate* DynFunc = FindDynamicEventDelegate(Context->GetType(), EventTypeIndex);
+        if (DynFunc != nullptr)
+            DynFunc->Broadcast(Context);
+    }
+}
 
-        if (Property != nullptr)
-            Delegate->DynFunc = Property->ContainerPtrToValuePtr<FGUIEventDynMDelegate>(this);
-        else
-            Delegate->DynFunc = nullptr;
+int32 UGObject::GetEventTypeIndex(const FName& EventType)
+{
+    static TMap<FName, int32> Indices;
+
+    int32* Index = Indices.Find(EventType);
+    if (Index != nullptr)
+        return *Index;
+
+    return Indices.Add(EventType, FMath::Min(Indices.Num(), OverflowEventTypeIndex));
+}
+
+const FEventDelegateTable& UGObject::GetEventDelegateTable() const
+{
+    if (EventDelegateTable == nullptr)
+        EventDelegateTable = &FEventDelegateTable::Get(GetClass());
+
+    return *EventDelegateTable;
+}
+
+FGUIEventMDelegate* UGObject::FindNativeEventDelegate(const FName& EventType) const
+{
+    for (const FNativeEventDelegate& Delegate : NativeEventDelegates)
+    {
+        if (Delegate.EventType == EventType)
+            return const_cast<FGUIEventMDelegate*>(&Delegate.Func);
     }
 
-    return *Delegate;
+    return nullptr;
+}
+
+FGUIEventDynMDelegate* UGObject::FindDynamicEventDelegate(const FName& EventType, int32 EventTypeIndex) const
+{
+    const FEventDelegateTable& Table = GetEventDelegateTable();
+    const FMulticastInlineDelegateProperty* Property = EventTypeIndex < OverflowEventTypeIndex
+        ? Table.Properties[EventTypeIndex] : Table.OverflowProperties.FindRef(EventType);
+    if (Property == nullptr)
+        return nullptr;
+
+    return Property->ContainerPtrToValuePtr<FGUIEventDynMDelegate>(const_cast<UGObject*>(this));
 }
 
 FGUIEventMDelegate& UGObject::On(const FName& EventType)
 {
-    return GetEventDelegate(EventType).Func;
+    FGUIEventMDelegate* Func = FindNativeEventDelegate(EventType);
+    if (Func != nullptr)
+        return *Func;
+
+    NativeEventMask |= 1ull << GetEventTypeIndex(EventType);
+
+    FNativeEventDelegate& Delegate = NativeEventDelegates.AddDefaulted_GetRef();
+    Delegate.EventType = EventType;
+    return Delegate.Func;
 }
 
 void UGObject::ConstructFromResource()
@@ -793,7 +916,11 @@ void UGObject::SetupAfterAdd(FByteBuffer* Buffer, int32 BeginPos)
 
     int16 groupId = Buffer->ReadShort();
     if (groupId >= 0)
+    {
         Group = Cast<UGGroup>(Parent->GetChildAt(groupId));
+        if (Group.IsValid())
+            Group->InvalidateMembers();
+    }
 
     Buffer->Seek(BeginPos, 2);
 
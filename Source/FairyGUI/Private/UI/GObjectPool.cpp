@@ -1,6 +1,40 @@
 #include "UI/GObjectPool.h"
 #include "UI/GObject.h"
 #include "UI/UIPackage.h"
+#include "FairyApplication.h"
+#include "Misc/CoreDelegates.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Hits"), STAT_FairyGUI_PoolHits, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Misses"), STAT_FairyGUI_PoolMisses, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Constructions"), STAT_FairyGUI_PoolConstructions, STATGROUP_FairyGUI);
+DECLARE_CYCLE_STAT(TEXT("Pool Prewarm"), STAT_FairyGUI_PoolPrewarm, STATGROUP_FairyGUI);
+
+TArray<FGObjectPool*> FGObjectPool::AllPools;
+TArray<FGObjectPool*> FGObjectPool::PrewarmingPools;
+FTSTicker::FDelegateHandle FGObjectPool::TickerHandle;
+FDelegateHandle FGObjectPool::MemoryTrimHandle;
+
+FGObjectPool::FGObjectPool() :
+    bScheduled(false)
+{
+    if (AllPools.Num() == 0)
+        MemoryTrimHandle = FCoreDelegates::GetMemoryTrimDelegate().AddStatic(&FGObjectPool::OnMemoryTrim);
+    AllPools.Add(this);
+}
+
+FGObjectPool::~FGObjectPool()
+{
+    AllPools.RemoveSingleSwap(this);
+    if (AllPools.Num() == 0)
+        FCoreDelegates::GetMemoryTrimDelegate().Remove(MemoryTrimHandle);
+
+    if (bScheduled)
+    {
+        PrewarmingPools.Remove(this);
+        if (PrewarmingPools.Num() == 0)
+            FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    }
+}
 
 UGObject* FGObjectPool::GetObject(const FString & URL, UObject* WorldContextObject)
 {
@@ -9,25 +43,207 @@ UGObject* FGObjectPool::GetObject(const FString & URL, UObject* WorldContextObje
         return nullptr;
 
     UGObject* ret;
-    TArray<TObjectPtr<UGObject>>& arr = Pool.FindOrAdd(URL2);
-    if (arr.Num() > 0)
-        ret = arr.Pop();
+    FEntry& Entry = Pool.FindOrAdd(URL2);
+    Entry.LastUsedTime = FPlatformTime::Seconds();
+    if (Entry.Objects.Num() > 0)
+    {
+        ret = Entry.Objects.Pop();
+        Stats.Hits++;
+        INC_DWORD_STAT(STAT_FairyGUI_PoolHits);
+    }
     else
+    {
         ret = UUIPackage::CreateObjectFromURL(URL2, WorldContextObject);
+        Stats.Misses++;
+        INC_DWORD_STAT(STAT_FairyGUI_PoolMisses);
+        if (ret != nullptr)
+        {
+            Stats.Constructions++;
+            INC_DWORD_STAT(STAT_FairyGUI_PoolConstructions);
+        }
+    }
+
+    if (Entry.bPrewarming || Entry.Objects.Num() < Entry.LowWatermark)
+    {
+        if (!Entry.WorldContextObject.IsValid())
+            Entry.WorldContextObject = WorldContextObject;
+        Entry.bPrewarming = true;
+        SchedulePrewarm();
+    }
     return ret;
 }
 
 void FGObjectPool::ReturnObject(UGObject* Obj)
 {
-    TArray<TObjectPtr<UGObject>>& Arr = Pool.FindOrAdd(Obj->GetResourceURL());
-    Arr.Add(Obj);
+    FEntry& Entry = Pool.FindOrAdd(Obj->GetResourceURL());
+    Entry.LastUsedTime = FPlatformTime::Seconds();
+    if (Entry.Objects.Num() >= Entry.HighWatermark)
+    {
+        Stats.Released++;
+        return;
+    }
+
+    Entry.Objects.Add(Obj);
+}
+
+void FGObjectPool::Prewarm(const FString& URL, int32 LowWatermark, UObject* WorldContextObject, bool bHighPriority, int32 HighWatermark)
+{
+    FString URL2 = UUIPackage::NormalizeURL(URL);
+    if (URL2.Len() == 0)
+        return;
+
+    FEntry& Entry = Pool.FindOrAdd(URL2);
+    Entry.LowWatermark = FMath::Max(LowWatermark, 0);
+    Entry.HighWatermark = FMath::Max(HighWatermark, Entry.LowWatermark);
+    Entry.bHighPriority = bHighPriority;
+    Entry.WorldContextObject = WorldContextObject;
+    Entry.LastUsedTime = FPlatformTime::Seconds();
+
+    if (Entry.Objects.Num() > Entry.HighWatermark)
+        ReleaseObjects(Entry, Entry.HighWatermark);
+    else if (Entry.Objects.Num() < Entry.LowWatermark)
+    {
+        Entry.bPrewarming = true;
+        SchedulePrewarm();
+    }
+}
+
+void FGObjectPool::CancelPrewarm(const FString& URL)
+{
+    FEntry* Entry = Pool.Find(UUIPackage::NormalizeURL(URL));
+    if (Entry != nullptr)
+    {
+        Entry->LowWatermark = 0;
+        Entry->HighWatermark = MAX_int32;
+        Entry->bPrewarming = false;
+    }
+}
+
+void FGObjectPool::Trim(float IdleSeconds)
+{
+    const double Now = FPlatformTime::Seconds();
+    for (auto& it : Pool)
+    {
+        FEntry& Entry = it.Value;
+        if (IdleSeconds <= 0)
+            ReleaseObjects(Entry, Entry.LowWatermark);
+        else if (Now - Entry.LastUsedTime >= IdleSeconds)
+            ReleaseObjects(Entry, 0);
+    }
+}
+
+void FGObjectPool::Clear()
+{
+    for (auto& it : Pool)
+        ReleaseObjects(it.Value, 0);
+}
+
+int32 FGObjectPool::GetIdleCount(const FString& URL) const
+{
+    const FEntry* Entry = Pool.Find(UUIPackage::NormalizeURL(URL));
+    return Entry != nullptr ? Entry->Objects.Num() : 0;
+}
+
+void FGObjectPool::ReleaseObjects(FEntry& Entry, int32 KeepCount)
+{
+    int32 Count = Entry.Objects.Num() - KeepCount;
+    if (Count > 0)
+    {
+        Entry.Objects.SetNum(KeepCount);
+        Stats.Released += Count;
+    }
+}
+
+void FGObjectPool::SchedulePrewarm()
+{
+    if (bScheduled)
+        return;
+
+    bScheduled = true;
+    if (PrewarmingPools.Num() == 0)
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FGObjectPool::TickPrewarm));
+    PrewarmingPools.Add(this);
+}
+
+bool FGObjectPool::PrewarmStep(double EndTime, bool bHighPriority)
+{
+    bool bPending = false;
+    for (auto& it : Pool)
+    {
+        FEntry& Entry = it.Value;
+        if (!Entry.bPrewarming)
+            continue;
+
+        if (!Entry.WorldContextObject.IsValid())
+        {
+            Entry.bPrewarming = false;
+            continue;
+        }
+
+        if (Entry.bHighPriority != bHighPriority)
+        {
+            bPending = true;
+            continue;
+        }
+
+        while (Entry.Objects.Num() < Entry.LowWatermark && FPlatformTime::Seconds() < EndTime)
+        {
+            UGObject* Obj = UUIPackage::CreateObjectFromURL(it.Key, Entry.WorldContextObject.Get());
+            if (Obj == nullptr)
+            {
+                Entry.LowWatermark = 0;
+                break;
+            }
+
+            Entry.Objects.Add(Obj);
+            Stats.Constructions++;
+            INC_DWORD_STAT(STAT_FairyGUI_PoolConstructions);
+        }
+
+        if (Entry.Objects.Num() >= Entry.LowWatermark)
+            Entry.bPrewarming = false;
+        else
+            bPending = true;
+    }
+    return bPending;
+}
+
+bool FGObjectPool::TickPrewarm(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_FairyGUI_PoolPrewarm);
+
+    const double EndTime = FPlatformTime::Seconds() + UFairyApplication::UIConfig.PoolPrewarmFrameBudget;
+
+    // High priority requests of every pool are served before any low priority one.
+    // Constructing objects may destroy other lists, which removes their pools from the array,
+    // and may schedule new ones, which are appended and picked up by the same pass.
+    for (int32 i = 0; i < PrewarmingPools.Num(); i++)
+        PrewarmingPools[i]->PrewarmStep(EndTime, true);
+
+    for (int32 i = 0; i < PrewarmingPools.Num(); i++)
+    {
+        FGObjectPool* Pool = PrewarmingPools[i];
+        if (!Pool->PrewarmStep(EndTime, false) && PrewarmingPools.IsValidIndex(i) && PrewarmingPools[i] == Pool)
+        {
+            Pool->bScheduled = false;
+            PrewarmingPools.RemoveAt(i--);
+        }
+    }
+
+    return PrewarmingPools.Num() > 0;
+}
+
+void FGObjectPool::OnMemoryTrim()
+{
+    for (FGObjectPool* Pool : AllPools)
+        Pool->Trim();
 }
 
 void FGObjectPool::AddReferencedObjects(FReferenceCollector& Collector)
 {
     for (auto& Elem : Pool)
     {
-        Collector.AddReferencedObjects(Elem.Value);
+        Collector.AddReferencedObjects(Elem.Value.Objects);
     }
 }
 
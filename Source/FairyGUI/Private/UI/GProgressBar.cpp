@@ -65,7 +65,7 @@ void UGProgressBar::TweenValue(float InValue, float Duration)
         oldValule = Value;
 
     Value = InValue;
-    TweenHandle = FGTween::To(oldValule, Value, Duration)
+    TweenHandle = FGTween::To(oldValule, Value, Duration, this)
         ->SetEase(EEaseType::Linear)
         ->OnUpdate(FTweenDelegate::CreateStatic(&FGTweenAction::SetProgress))
         ->SetTarget(this)
@@ -1,4 +1,5 @@
 #include "UI/GRichTextField.h"
+#include "Widgets/STextField.h"
 
 UGRichTextField::UGRichTextField()
 {
@@ -6,4 +7,25 @@ UGRichTextField::UGRichTextField()
 
 UGRichTextField::~UGRichTextField()
 {
+}
+
+void UGRichTextField::AppendLine(const FString& InLine)
+{
+    //template variables can change the whole text
+    if (TemplateVars.IsSet() || Text.IsEmpty())
+    {
+        SetText(Text.IsEmpty() ? InLine : Text + TEXT("\n") + InLine);
+        return;
+    }
+
+    if (!bFormatApplied)
+        ApplyFormat();
+    Text.AppendChar('\n');
+    Text.Append(InLine);
+    bTemplateCompiled = false;
+
+    Content->AppendLine(InLine, bUBBEnabled || bSupportHTML, bUBBEnabled);
+
+    UpdateSize();
+    UpdateGear(6);
 }
\ No newline at end of file
@@ -38,6 +38,7 @@ void UGRoot::AddToViewport()
     FullScreenCanvas->SetOpaque(false);
     FullScreenCanvas->AddChild(GetDisplayObject());
     ViewportClient->AddViewportWidgetContent(FullScreenCanvas, 100);
+    ++SDisplayObject::HierarchyRevision;
 
     SetSize(FullScreenCanvas->GetParentWidget()->GetPaintSpaceGeometry().GetLocalSize().RoundToVector());
 }
@@ -22,22 +22,21 @@ void UGTextField::SetText(const FString& InText)
 {
     if (!bFormatApplied)
         ApplyFormat();
-    Text = InText;
-
-    if (bUBBEnabled)
+    if (&InText != &Text)
     {
-        FString parsedText = FUBBParser::DefaultParser.Parse(Text);
-        if (TemplateVars.IsSet())
-            parsedText = ParseTemplate(parsedText);
-        Content->SetText(parsedText, true);
+        Text = InText;
+        bTemplateCompiled = false;
     }
+    bTemplateVarsChanged = false;
+
+    //variables are substituted into the html made from the ubb, so their values are html, not ubb
+    if (TemplateVars.IsSet())
+        Content->SetText(ApplyTemplate(), bUBBEnabled || bSupportHTML);
+    //the text field tokenizes ubb itself when it lays out
+    else if (bUBBEnabled)
+        Content->SetText(Text, true, true);
     else
-    {
-        if (TemplateVars.IsSet())
-            Content->SetText(ParseTemplate(Text), bSupportHTML);
-        else
-            Content->SetText(Text, bSupportHTML);
-    }
+        Content->SetText(Text, bSupportHTML);
     Content->SetMaxWidth(MaxSize.X);
 
     UpdateSize();
@@ -49,6 +48,7 @@ void UGTextField::SetUBBEnabled(bool bFlag)
     if (bUBBEnabled != bFlag)
     {
         bUBBEnabled = bFlag;
+        bTemplateCompiled = false;
         SetText(Text);
     }
 }
@@ -106,69 +106,125 @@ UGTextField* UGTextField::SetVar(const FString& VarKey, const FString& VarValue)
 {
     if (!TemplateVars.IsSet())
         TemplateVars.Emplace();
-    TemplateVars.GetValue().Add(VarKey, VarValue);
+
+    FString* Value = TemplateVars.GetValue().Find(VarKey);
+    if (Value == nullptr)
+        TemplateVars.GetValue().Add(VarKey, VarValue);
+    else if (!Value->Equals(VarValue, ESearchCase::CaseSensitive))
+        *Value = VarValue;
+    else
+        return this;
+
+    if (!bTemplateCompiled || TemplateSegments.ContainsByPredicate([&VarKey](const FTemplateSegment& Segment) { return Segment.VarKey == VarKey; }))
+        bTemplateVarsChanged = true;
 
     return this;
 }
 
+void UGTextField::SetVars(const TMap<FString, FString>& InVars)
+{
+    TemplateVars = InVars;
+    bTemplateVarsChanged = true;
+}
+
 void UGTextField::FlushVars()
 {
+    //no variable used by the text has changed since it was last applied
+    if (!bTemplateVarsChanged)
+        return;
+
     SetText(Text);
 }
 
-FString UGTextField::ParseTemplate(const FString& Template)
+void UGTextField::CompileTemplate()
 {
+    bTemplateCompiled = true;
+    TemplateSegments.Reset();
+
+    //ubb is turned into html before the variables are found, as it always was
+    FString ParsedText;
+    if (bUBBEnabled)
+        ParsedText = FUBBParser::DefaultParser.Parse(Text);
+    const FString& Source = bUBBEnabled ? ParsedText : Text;
+
     int32 pos1 = 0, pos2 = 0;
     int32 pos3;
-    FString tag;
-    FString value;
-    FString buffer;
-    TMap<FString, FString>& Vars = TemplateVars.GetValue();
+    FString literal;
 
-    while ((pos2 = Template.Find("{", ESearchCase::CaseSensitive, ESearchDir::FromStart, pos1)) != -1)
+    auto FlushLiteral = [this, &literal]()
     {
-        if (pos2 > 0 && Template[pos2 - 1] == '\\')
+        if (!literal.IsEmpty())
         {
-            buffer.Append(*Template + pos1, pos2 - pos1 - 1);
-            buffer.AppendChar('{');
+            TemplateSegments.AddDefaulted_GetRef().Text = MoveTemp(literal);
+            literal.Reset();
+        }
+    };
+
+    while ((pos2 = Source.Find("{", ESearchCase::CaseSensitive, ESearchDir::FromStart, pos1)) != -1)
+    {
+        if (pos2 > 0 && Source[pos2 - 1] == '\\')
+        {
+            literal.Append(*Source + pos1, pos2 - pos1 - 1);
+            literal.AppendChar('{');
             pos1 = pos2 + 1;
             continue;
         }
 
-        buffer.Append(*Template + pos1, pos2 - pos1);
+        literal.Append(*Source + pos1, pos2 - pos1);
         pos1 = pos2;
-        pos2 = Template.Find("}", ESearchCase::CaseSensitive, ESearchDir::FromStart, pos1);
+        pos2 = Source.Find("}", ESearchCase::CaseSensitive, ESearchDir::FromStart, pos1);
         if (pos2 == -1)
             break;
 
         if (pos2 == pos1 + 1)
         {
-            buffer.Append(*Template + pos1, 2);
+            literal.Append(*Source + pos1, 2);
             pos1 = pos2 + 1;
             continue;
         }
 
-        tag = Template.Mid(pos1 + 1, pos2 - pos1 - 1);
-        if (tag.FindChar('=', pos3))
+        FlushLiteral();
+
+        FTemplateSegment& Segment = TemplateSegments.AddDefaulted_GetRef();
+        Segment.VarKey = Source.Mid(pos1 + 1, pos2 - pos1 - 1);
+        if (Segment.VarKey.FindChar('=', pos3))
         {
-            FString* ptr = Vars.Find(tag.Mid(0, pos3));
-            if (ptr != nullptr)
-                buffer.Append(*ptr);
-            else
-                buffer.Append(tag.Mid(pos3 + 1));
+            Segment.Text = Segment.VarKey.Mid(pos3 + 1);
+            Segment.VarKey.LeftInline(pos3);
         }
-        else
+        pos1 = pos2 + 1;
+    }
+    if (pos1 < Source.Len())
+        literal.Append(*Source + pos1, Source.Len() - pos1);
+
+    FlushLiteral();
+}
+
+const FString& UGTextField::ApplyTemplate()
+{
+    if (!bTemplateCompiled)
+        CompileTemplate();
+
+    const TMap<FString, FString>& Vars = TemplateVars.GetValue();
+    TArray<const FString*, TInlineAllocator<16>> Values;
+    int32 Length = 0;
+    for (const FTemplateSegment& Segment : TemplateSegments)
+    {
+        const FString* Value = &Segment.Text;
+        if (!Segment.VarKey.IsEmpty())
         {
-            FString* ptr = Vars.Find(tag);
-            if (ptr != nullptr)
-                buffer.Append(*ptr);
+            if (const FString* VarValue = Vars.Find(Segment.VarKey))
+                Value = VarValue;
         }
-        pos1 = pos2 + 1;
+        Values.Add(Value);
+        Length += Value->Len();
     }
-    if (pos1 < Template.Len())
-        buffer.Append(Template.Mid(pos1, Template.Len() - pos1));
 
-    return buffer;
+    TemplateBuffer.Reset(Length);
+    for (const FString* Value : Values)
+        TemplateBuffer.Append(*Value);
+
+    return TemplateBuffer;
 }
 
 FNVariant UGTextField::GetProp(EObjectPropID PropID) const
@@ -21,25 +21,25 @@ void FGearAnimation::Init()
 {
     Default.bPlaying = Owner->GetProp<bool>(EObjectPropID::Playing);
     Default.Frame = Owner->GetProp<int32>(EObjectPropID::Frame);
-    Storage.Reset();
+    Storage.Reset(Controller->GetPageCount());
 }
 
-void FGearAnimation::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearAnimation::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
     FValue Value;
     Value.bPlaying = Buffer->ReadBool();
     Value.Frame = Buffer->ReadInt();
-    if (PageID.IsEmpty())
+    if (PageIndex == INDEX_NONE)
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(PageIndex, MoveTemp(Value));
 }
 
 void FGearAnimation::Apply()
 {
     Owner->bGearLocked = true;
 
-    FValue* Value = Storage.Find(Controller->GetSelectedPageID());
+    FValue* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -54,5 +54,5 @@ void FGearAnimation::UpdateState()
     FValue Value;
     Value.bPlaying = Owner->GetProp<bool>(EObjectPropID::Playing);
     Value.Frame = Owner->GetProp<int32>(EObjectPropID::Frame);
-    Storage.Add(Controller->GetSelectedPageID(), MoveTemp(Value));
+    Storage.Add(Controller->GetSelectedIndex(), MoveTemp(Value));
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "UI/Gears/GearText.h"
 #include "UI/Gears/GearXY.h"
 #include "UI/GComponent.h"
+#include "UI/GController.h"
 #include "Utils/ByteBuffer.h"
 
 bool FGearBase::bDisableAllTweenEffect = false;
@@ -63,7 +64,7 @@ FGearTweenConfig::FGearTweenConfig():
 {
 }
 
-FGearBase::FGearBase(UGObject* InOwner) : Owner(InOwner)
+FGearBase::FGearBase(UGObject* InOwner) : Owner(InOwner), Controller(nullptr)
 {
 }
 
@@ -75,9 +76,14 @@ void FGearBase::SetController(UGController* InController)
 {
     if (Controller != InController)
     {
+        if (Controller != nullptr)
+            Controller->RemoveSubscriber(Owner);
         Controller = InController;
         if (Controller != nullptr)
+        {
+            Controller->AddSubscriber(Owner);
             Init();
+        }
     }
 }
 
@@ -93,7 +99,7 @@ void FGearBase::Init()
 {
 }
 
-void FGearBase::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearBase::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
 }
 
@@ -109,19 +115,33 @@ void FGearBase::UpdateFromRelations(const FVector2D& Delta)
 {
 }
 
+int32 FGearBase::ResolvePageIndex(const FString& PageID) const
+{
+    //a page the controller doesn't have still has its status read, it is stored past the last page and dropped
+    int32 Index = Controller->GetPageIndexByID(PageID);
+    return Index != INDEX_NONE ? Index : Controller->GetPageCount();
+}
+
 void FGearBase::Setup(FByteBuffer* Buffer)
 {
     Controller = Owner->GetParent()->GetControllerAt(Buffer->ReadShort());
+    Controller->AddSubscriber(Owner);
     Init();
 
     int32 Count = Buffer->ReadShort();
     FGearDisplay* g0 = Type == EType::Display ? static_cast<FGearDisplay*>(this) : nullptr;
     FGearDisplay2* g1 = Type == EType::Display2 ? static_cast<FGearDisplay2*>(this) : nullptr;
     FGearXY* g2 = nullptr;
-    if (g0)
-        Buffer->ReadSArray(g0->Pages, Count);
-    else if (g1)
-        Buffer->ReadSArray(g1->Pages, Count);
+    //page IDs are resolved to page indices once here, so Apply and UpdateState index the storage directly
+    if (g0 || g1)
+    {
+        TArray<FString> Pages;
+        Buffer->ReadSArray(Pages, Count);
+        if (g0)
+            g0->SetPages(Pages);
+        else
+            g1->SetPages(Pages);
+    }
     else
     {
         for (int32 i = 0; i < Count; i++)
@@ -130,11 +150,11 @@ void FGearBase::Setup(FByteBuffer* Buffer)
             if (page.IsEmpty())
                 continue;
 
-            AddStatus(page, Buffer);
+            AddStatus(ResolvePageIndex(page), Buffer);
         }
 
         if (Buffer->ReadBool())
-            AddStatus(G_EMPTY_STRING, Buffer);
+            AddStatus(INDEX_NONE, Buffer);
     }
 
     if (Buffer->ReadBool())
@@ -162,11 +182,11 @@ void FGearBase::Setup(FByteBuffer* Buffer)
                         if (page.IsEmpty())
                             continue;
 
-                        g2->AddExtStatus(page, Buffer);
+                        g2->AddExtStatus(ResolvePageIndex(page), Buffer);
                     }
 
                     if (Buffer->ReadBool())
-                        g2->AddExtStatus(G_EMPTY_STRING, Buffer);
+                        g2->AddExtStatus(INDEX_NONE, Buffer);
                 }
             }
         }
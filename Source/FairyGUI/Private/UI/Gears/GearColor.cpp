@@ -22,23 +22,23 @@ void FGearColor::Init()
 {
     Default.Color = Owner->GetProp<FColor>(EObjectPropID::Color);
     Default.OutlineColor = Owner->GetProp<FColor>(EObjectPropID::OutlineColor);
-    Storage.Reset();
+    Storage.Reset(Controller->GetPageCount());
 }
 
-void FGearColor::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearColor::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
     FValue Value;
     Value.Color = Buffer->ReadColor();
     Value.OutlineColor = Buffer->ReadColor();
-    if (PageID.IsEmpty())
+    if (PageIndex == INDEX_NONE)
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(PageIndex, MoveTemp(Value));
 }
 
 void FGearColor::Apply()
 {
-    FValue* Value = Storage.Find(Controller->GetSelectedPageID());
+    FValue* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -68,7 +68,7 @@ void FGearColor::Apply()
             if (Owner->CheckGearController(0, Controller))
                 TweenConfig->DisplayLockToken = Owner->AddDisplayLock();
 
-            TweenConfig->Handle = FGTween::To(curColor, Value->Color, TweenConfig->Duration)
+            TweenConfig->Handle = FGTween::To(curColor, Value->Color, TweenConfig->Duration, Owner)
                 ->SetDelay(TweenConfig->Delay)
                 ->SetEase(TweenConfig->EaseType)
                 ->SetTarget(Owner)
@@ -109,5 +109,5 @@ void FGearColor::UpdateState()
     FValue Value;
     Value.Color = Owner->GetProp<FColor>(EObjectPropID::Color);
     Value.OutlineColor = Owner->GetProp<FColor>(EObjectPropID::OutlineColor);
-    Storage.Add(Controller->GetSelectedPageID(), MoveTemp(Value));
+    Storage.Add(Controller->GetSelectedIndex(), MoveTemp(Value));
 }
@@ -24,7 +24,8 @@ void FGearDisplay::Apply()
         Visible = 1;
     else
     {
-        if (Pages.Contains(Controller->GetSelectedPageID()))
+        int32 Index = Controller->GetSelectedIndex();
+        if (VisiblePages.IsValidIndex(Index) && VisiblePages[Index])
             Visible = 1;
         else
             Visible = 0;
@@ -35,13 +36,37 @@ void FGearDisplay::UpdateState()
 {
 }
 
-void FGearDisplay::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearDisplay::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
 }
 
 void FGearDisplay::Init()
 {
     Pages.Reset();
+    VisiblePages.Reset();
+}
+
+void FGearDisplay::SetPages(const TArray<FString>& InPages)
+{
+    Pages = InPages;
+    ResolvePages();
+}
+
+void FGearDisplay::ResolvePages()
+{
+    if (Controller == nullptr)
+    {
+        VisiblePages.Reset();
+        return;
+    }
+
+    VisiblePages.Init(false, Controller->GetPageCount());
+    for (const FString& PageID : Pages)
+    {
+        int32 Index = Controller->GetPageIndexByID(PageID);
+        if (Index != INDEX_NONE)
+            VisiblePages[Index] = true;
+    }
 }
 
 uint32 FGearDisplay::AddLock()
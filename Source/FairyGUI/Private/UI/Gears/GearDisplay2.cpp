@@ -20,7 +20,8 @@ void FGearDisplay2::Apply()
         Visible = 1;
     else
     {
-        if (Pages.Contains(Controller->GetSelectedPageID()))
+        int32 Index = Controller->GetSelectedIndex();
+        if (VisiblePages.IsValidIndex(Index) && VisiblePages[Index])
             Visible = 1;
         else
             Visible = 0;
@@ -41,11 +42,35 @@ void FGearDisplay2::UpdateState()
 {
 }
 
-void FGearDisplay2::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearDisplay2::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
 }
 
 void FGearDisplay2::Init()
 {
     Pages.Reset();
+    VisiblePages.Reset();
+}
+
+void FGearDisplay2::SetPages(const TArray<FString>& InPages)
+{
+    Pages = InPages;
+    ResolvePages();
+}
+
+void FGearDisplay2::ResolvePages()
+{
+    if (Controller == nullptr)
+    {
+        VisiblePages.Reset();
+        return;
+    }
+
+    VisiblePages.Init(false, Controller->GetPageCount());
+    for (const FString& PageID : Pages)
+    {
+        int32 Index = Controller->GetPageIndexByID(PageID);
+        if (Index != INDEX_NONE)
+            VisiblePages[Index] = true;
+    }
 }
@@ -15,20 +15,20 @@ FGearFontSize::~FGearFontSize()
 void FGearFontSize::Init()
 {
     Default = Owner->GetProp<int32>(EObjectPropID::FontSize);
-    Storage.Reset();
+    Storage.Reset(Controller->GetPageCount());
 }
 
-void FGearFontSize::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearFontSize::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
-    if (PageID.IsEmpty())
+    if (PageIndex == INDEX_NONE)
         Default = Buffer->ReadInt();
     else
-        Storage.Add(PageID, Buffer->ReadInt());
+        Storage.Add(PageIndex, Buffer->ReadInt());
 }
 
 void FGearFontSize::Apply()
 {
-    int32* Value = Storage.Find(Controller->GetSelectedPageID());
+    int32* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -39,5 +39,5 @@ void FGearFontSize::Apply()
 
 void FGearFontSize::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), Owner->GetProp<int32>(EObjectPropID::FontSize));
+    Storage.Add(Controller->GetSelectedIndex(), Owner->GetProp<int32>(EObjectPropID::FontSize));
 }
@@ -15,20 +15,20 @@ FGearIcon::~FGearIcon()
 void FGearIcon::Init()
 {
     Default = Owner->GetIcon();
-    Storage.Reset();
+    Storage.Reset(Controller->GetPageCount());
 }
 
-void FGearIcon::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearIcon::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
-    if (PageID.IsEmpty())
+    if (PageIndex == INDEX_NONE)
         Default = Buffer->ReadS();
     else
-        Storage.Add(PageID, Buffer->ReadS());
+        Storage.Add(PageIndex, Buffer->ReadS());
 }
 
 void FGearIcon::Apply()
 {
-    FString* Value = Storage.Find(Controller->GetSelectedPageID());
+    FString* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -39,5 +39,5 @@ void FGearIcon::Apply()
 
 void FGearIcon::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), Owner->GetIcon());
+    Storage.Add(Controller->GetSelectedIndex(), Owner->GetIcon());
 }
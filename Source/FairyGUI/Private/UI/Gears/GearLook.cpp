@@ -28,10 +28,10 @@ void FGearLook::Init()
     Default.Rotation = Owner->GetRotation();
     Default.bGrayed = Owner->IsGrayed();
     Default.bTouchable = Owner->IsTouchable();
-    Storage.Reset();
+    Storage.Reset(Controller->GetPageCount());
 }
 
-void FGearLook::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearLook::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
     FValue Value;
     Value.Alpha = Buffer->ReadFloat();
@@ -39,15 +39,15 @@ void FGearLook::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     Value.bGrayed = Buffer->ReadBool();
     Value.bTouchable = Buffer->ReadBool();
 
-    if (PageID.IsEmpty())
+    if (PageIndex == INDEX_NONE)
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(PageIndex, MoveTemp(Value));
 }
 
 void FGearLook::Apply()
 {
-    FValue* Value = Storage.Find(Controller->GetSelectedPageID());
+    FValue* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -74,7 +74,7 @@ void FGearLook::Apply()
             if (Owner->CheckGearController(0, Controller))
                 TweenConfig->DisplayLockToken = Owner->AddDisplayLock();
 
-            TweenConfig->Handle = FGTween::To(FVector2D(Owner->GetAlpha(), Owner->GetRotation()), FVector2D(Value->Alpha, Value->Rotation), TweenConfig->Duration)
+            TweenConfig->Handle = FGTween::To(FVector2D(Owner->GetAlpha(), Owner->GetRotation()), FVector2D(Value->Alpha, Value->Rotation), TweenConfig->Duration, Owner)
                 ->SetDelay(TweenConfig->Delay)
                 ->SetEase(TweenConfig->EaseType)
                 ->SetTarget(Owner)
@@ -125,5 +125,5 @@ void FGearLook::UpdateState()
     Value.Rotation = Owner->GetRotation();
     Value.bGrayed = Owner->IsGrayed();
     Value.bTouchable = Owner->IsTouchable();
-    Storage.Add(Controller->GetSelectedPageID(), MoveTemp(Value));
+    Storage.Add(Controller->GetSelectedIndex(), MoveTemp(Value));
 }
@@ -18,10 +18,10 @@ void FGearSize::Init()
 {
     Default = FVector4(Owner->GetWidth(), Owner->GetHeight(),
         Owner->GetScaleX(), Owner->GetScaleY());
-    Storage.Reset();
+    Storage.Reset(Controller->GetPageCount());
 }
 
-void FGearSize::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearSize::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
     FVector4 Value;
     Value.X = Buffer->ReadInt();
@@ -29,15 +29,15 @@ void FGearSize::AddStatus(const FString& PageID, FByteBuffer* Buffer)
     Value.Z = Buffer->ReadFloat();
     Value.W = Buffer->ReadFloat();
 
-    if (PageID.IsEmpty())
+    if (PageIndex == INDEX_NONE)
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(PageIndex, MoveTemp(Value));
 }
 
 void FGearSize::Apply()
 {
-    FVector4* Value = Storage.Find(Controller->GetSelectedPageID());
+    FVector4* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -59,7 +59,7 @@ void FGearSize::Apply()
             if (Owner->CheckGearController(0, Controller))
                 TweenConfig->DisplayLockToken = Owner->AddDisplayLock();
 
-            TweenConfig->Handle = FGTween::To(FVector4(Owner->GetWidth(), Owner->GetHeight(), Owner->GetScaleX(), Owner->GetScaleY()), *Value, TweenConfig->Duration)
+            TweenConfig->Handle = FGTween::To(FVector4(Owner->GetWidth(), Owner->GetHeight(), Owner->GetScaleX(), Owner->GetScaleY()), *Value, TweenConfig->Duration, Owner)
                 ->SetDelay(TweenConfig->Delay)
                 ->SetEase(TweenConfig->EaseType)
                 ->SetTarget(Owner)
@@ -102,7 +102,7 @@ void FGearSize::OnTweenComplete()
 
 void FGearSize::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), FVector4(Owner->GetWidth(), Owner->GetHeight(),
+    Storage.Add(Controller->GetSelectedIndex(), FVector4(Owner->GetWidth(), Owner->GetHeight(),
         Owner->GetScaleX(), Owner->GetScaleY()));
 }
 
@@ -110,11 +110,11 @@ void FGearSize::UpdateFromRelations(const FVector2D& Delta)
 {
     if (Controller != nullptr && Storage.Num() > 0)
     {
-        for (auto It = Storage.CreateIterator(); It; ++It)
+        Storage.ForEach([&Delta](FVector4& Value)
         {
-            It->Value = FVector4(It->Value.X + Delta.X, It->Value.Y + Delta.Y,
-                It->Value.Z, It->Value.W);
-        }
+            Value.X += Delta.X;
+            Value.Y += Delta.Y;
+        });
         Default.X += Delta.X;
         Default.Y += Delta.Y;
 
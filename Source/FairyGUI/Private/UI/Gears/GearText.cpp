@@ -15,20 +15,20 @@ FGearText::~FGearText()
 void FGearText::Init()
 {
     Default = Owner->GetText();
-    Storage.Reset();
+    Storage.Reset(Controller->GetPageCount());
 }
 
-void FGearText::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearText::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
-    if (PageID.IsEmpty())
+    if (PageIndex == INDEX_NONE)
         Default = Buffer->ReadS();
     else
-        Storage.Add(PageID, Buffer->ReadS());
+        Storage.Add(PageIndex, Buffer->ReadS());
 }
 
 void FGearText::Apply()
 {
-    FString* Value = Storage.Find(Controller->GetSelectedPageID());
+    FString* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -39,5 +39,5 @@ void FGearText::Apply()
 
 void FGearText::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), Owner->GetText());
+    Storage.Add(Controller->GetSelectedIndex(), Owner->GetText());
 }
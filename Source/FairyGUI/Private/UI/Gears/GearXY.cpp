@@ -22,31 +22,36 @@ void FGearXY::Init()
         Owner->GetY(),
         Owner->GetX() / Owner->GetParent()->GetWidth(),
         Owner->GetY() / Owner->GetParent()->GetHeight());
-    Storage.Reset();
+    Storage.Reset(Controller->GetPageCount());
 }
 
-void FGearXY::AddStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearXY::AddStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
     FVector4 Value;
     Value.X = Buffer->ReadInt();
     Value.Y = Buffer->ReadInt();
 
-    if (PageID.IsEmpty())
+    if (PageIndex == INDEX_NONE)
         Default = Value;
     else
-        Storage.Add(PageID, MoveTemp(Value));
+        Storage.Add(PageIndex, MoveTemp(Value));
 }
 
-void FGearXY::AddExtStatus(const FString& PageID, FByteBuffer* Buffer)
+void FGearXY::AddExtStatus(int32 PageIndex, FByteBuffer* Buffer)
 {
-    FVector4* Value = PageID.IsEmpty() ? &Default : Storage.Find(Controller->GetSelectedPageID());
-    Value->Z = Buffer->ReadFloat();
-    Value->W = Buffer->ReadFloat();
+    FVector4* Value = PageIndex == INDEX_NONE ? &Default : Storage.Find(PageIndex);
+    float Z = Buffer->ReadFloat();
+    float W = Buffer->ReadFloat();
+    if (Value != nullptr)
+    {
+        Value->Z = Z;
+        Value->W = W;
+    }
 }
 
 void FGearXY::Apply()
 {
-    FVector4* Value = Storage.Find(Controller->GetSelectedPageID());
+    FVector4* Value = Storage.Find(Controller->GetSelectedIndex());
     if (Value == nullptr)
         Value = &Default;
 
@@ -81,7 +86,7 @@ void FGearXY::Apply()
             if (Owner->CheckGearController(0, Controller))
                 TweenConfig->DisplayLockToken = Owner->AddDisplayLock();
 
-            TweenConfig->Handle = FGTween::To(OriginPt, EndPt, TweenConfig->Duration)
+            TweenConfig->Handle = FGTween::To(OriginPt, EndPt, TweenConfig->Duration, Owner)
                 ->SetDelay(TweenConfig->Delay)
                 ->SetEase(TweenConfig->EaseType)
                 ->SetTarget(Owner)
@@ -118,7 +123,7 @@ void FGearXY::OnTweenComplete()
 
 void FGearXY::UpdateState()
 {
-    Storage.Add(Controller->GetSelectedPageID(), FVector4(
+    Storage.Add(Controller->GetSelectedIndex(), FVector4(
         Owner->GetX(),
         Owner->GetY(),
         Owner->GetX() / Owner->GetParent()->GetWidth(),
@@ -129,11 +134,11 @@ void FGearXY::UpdateFromRelations(const FVector2D& Delta)
 {
     if (Controller != nullptr && Storage.Num() > 0 && !bPositionsInPercent)
     {
-        for (auto It = Storage.CreateIterator(); It; ++It)
+        Storage.ForEach([&Delta](FVector4& Value)
         {
-            It->Value = FVector4(It->Value.X + Delta.X, It->Value.Y + Delta.Y,
-                It->Value.Z, It->Value.W);
-        }
+            Value.X += Delta.X;
+            Value.Y += Delta.Y;
+        });
         Default.X += Delta.X;
         Default.Y += Delta.Y;
 
@@ -4,8 +4,12 @@
 #include "UI/GGroup.h"
 #include "UI/Transition.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Relation Evaluations"), STAT_FairyGUI_RelationEvaluations, STATGROUP_FairyGUI);
+
 FRelationItem::FRelationItem(UGObject* InOwner) :
-    TargetData(ForceInit)
+    TargetData(ForceInit),
+    bXYDirty(false),
+    bSizeDirty(false)
 {
     Owner = InOwner;
 }
@@ -563,7 +567,31 @@ void FRelationItem::OnTargetXYChanged()
         return;
     }
 
+    if (UFairyApplication::GetUIConfig().DeferRelations)
+    {
+        if (Owner->Relations->IsEchoOf(Target.Get()))
+        {
+            TargetData.X = Target->Position.X;
+            TargetData.Y = Target->Position.Y;
+            return;
+        }
+
+        bXYDirty = true;
+        Owner->Relations->MarkPending();
+        return;
+    }
+
+    ApplyTargetXY();
+}
+
+void FRelationItem::ApplyTargetXY()
+{
+    INC_DWORD_STAT(STAT_FairyGUI_RelationEvaluations);
+
+    bXYDirty = false;
     Owner->Relations->Handling = Target.Get();
+    Owner->Relations->AppliedFrom = Target.Get();
+    Owner->Relations->AppliedPass = FRelations::CurrentPass;
 
     FVector2D Pos = Owner->Position;
     float dx = Target->Position.X - TargetData.X;
@@ -601,7 +629,32 @@ void FRelationItem::OnTargetSizeChanged()
         TargetData.W = Target->Size.Y;
         return;
     }
+
+    if (UFairyApplication::GetUIConfig().DeferRelations)
+    {
+        if (Owner->Relations->IsEchoOf(Target.Get()))
+        {
+            TargetData.Z = Target->Size.X;
+            TargetData.W = Target->Size.Y;
+            return;
+        }
+
+        bSizeDirty = true;
+        Owner->Relations->MarkPending();
+        return;
+    }
+
+    ApplyTargetSize();
+}
+
+void FRelationItem::ApplyTargetSize()
+{
+    INC_DWORD_STAT(STAT_FairyGUI_RelationEvaluations);
+
+    bSizeDirty = false;
     Owner->Relations->Handling = Target.Get();
+    Owner->Relations->AppliedFrom = Target.Get();
+    Owner->Relations->AppliedPass = FRelations::CurrentPass;
 
     FVector2D Pos = Owner->Position;
     FVector2D RawSize = Owner->RawSize;
@@ -2,8 +2,23 @@
 #include "UI/GComponent.h"
 #include "Utils/ByteBuffer.h"
 
+DECLARE_CYCLE_STAT(TEXT("Relation Solve"), STAT_FairyGUI_RelationSolve, STATGROUP_FairyGUI);
+
+//an owner resolved more often than this in one pass is part of a cycle
+static constexpr int32 MaxResolvesPerPass = 8;
+
+TArray<TWeakObjectPtr<UGObject>> FRelations::PendingOwners;
+uint32 FRelations::CurrentPass = 0;
+bool FRelations::bSolving = false;
+
 FRelations::FRelations(UGObject* InOwner) :
-    Handling(nullptr)
+    Handling(nullptr),
+    bPending(false),
+    bResolving(false),
+    ResolvePass(0),
+    ResolveCount(0),
+    AppliedFrom(nullptr),
+    AppliedPass(0)
 {
     Owner = InOwner;
 }
@@ -108,30 +123,143 @@ bool FRelations::IsEmpty() const
     return Items.Num() == 0;
 }
 
+void FRelations::MarkPending()
+{
+    if (bPending)
+        return;
+
+    bPending = true;
+    PendingOwners.Add(Owner);
+}
+
+bool FRelations::IsEchoOf(UGObject* InTarget) const
+{
+    //the target is moving because it follows the owner, which moved because it follows the target.
+    //eager mode gets here while the owner is still applying and only syncs, so deferred mode must not apply again
+    return bSolving && AppliedPass == CurrentPass && AppliedFrom == InTarget
+        && InTarget->Relations->Handling == Owner;
+}
+
+void FRelations::SolvePending()
+{
+    if (bSolving || PendingOwners.Num() == 0)
+        return;
+
+    SCOPE_CYCLE_COUNTER(STAT_FairyGUI_RelationSolve);
+
+    bSolving = true;
+    CurrentPass++;
+
+    //owners dirtied while solving are appended and resolved in the same pass
+    for (int32 i = 0; i < PendingOwners.Num(); i++)
+    {
+        UGObject* Obj = PendingOwners[i].Get();
+        if (Obj != nullptr)
+            Obj->Relations->Resolve();
+    }
+
+    PendingOwners.Reset();
+    bSolving = false;
+}
+
+void FRelations::Resolve()
+{
+    if (!bPending)
+        return;
+
+    if (bResolving)
+    {
+        UE_LOG(LogFairyGUI, Warning, TEXT("relation cycle detected at %s"), *Owner->GetName());
+        return;
+    }
+
+    if (ResolvePass != CurrentPass)
+    {
+        ResolvePass = CurrentPass;
+        ResolveCount = 0;
+    }
+
+    bPending = false;
+    if (++ResolveCount > MaxResolvesPerPass)
+    {
+        UE_LOG(LogFairyGUI, Warning, TEXT("relation cycle detected at %s, giving up for this frame"), *Owner->GetName());
+        for (auto& it : Items)
+        {
+            it.bXYDirty = false;
+            it.bSizeDirty = false;
+        }
+        return;
+    }
+
+    //targets come first so that every owner is evaluated against their final layout
+    bResolving = true;
+    for (auto& it : Items)
+    {
+        UGObject* Target = it.Target.Get();
+        if (Target != nullptr && Target->Relations->bPending)
+            Target->Relations->Resolve();
+    }
+    bResolving = false;
+
+    for (auto& it : Items)
+    {
+        if (!it.Target.IsValid())
+        {
+            it.bXYDirty = false;
+            it.bSizeDirty = false;
+            continue;
+        }
+
+        if (it.bXYDirty)
+            it.ApplyTargetXY();
+        if (it.bSizeDirty)
+            it.ApplyTargetSize();
+    }
+}
+
 void FRelations::Setup(FByteBuffer * Buffer, bool bParentToChild)
+{
+    TArray<FRelationRecord> Records;
+    Decode(Buffer, Records);
+    Setup(Records, bParentToChild);
+}
+
+void FRelations::Decode(FByteBuffer* Buffer, TArray<FRelationRecord>& OutRecords)
 {
     int32 cnt = Buffer->ReadByte();
-    UGObject* target;
+    OutRecords.SetNum(cnt);
     for (int32 i = 0; i < cnt; i++)
     {
-        int16 targetIndex = Buffer->ReadShort();
-        if (targetIndex == -1)
+        FRelationRecord& Record = OutRecords[i];
+        Record.TargetIndex = Buffer->ReadShort();
+
+        int32 cnt2 = Buffer->ReadByte();
+        Record.Defs.SetNum(cnt2);
+        for (int32 j = 0; j < cnt2; j++)
+        {
+            Record.Defs[j].Key = (ERelationType)Buffer->ReadByte();
+            Record.Defs[j].Value = Buffer->ReadBool();
+        }
+    }
+}
+
+void FRelations::Setup(const TArray<FRelationRecord>& Records, bool bParentToChild)
+{
+    UGObject* target;
+    for (const FRelationRecord& Record : Records)
+    {
+        if (Record.TargetIndex == -1)
             target = Owner->GetParent();
         else if (bParentToChild)
-            target = (Cast<UGComponent>(Owner))->GetChildAt(targetIndex);
+            target = (Cast<UGComponent>(Owner))->GetChildAt(Record.TargetIndex);
         else
-            target = Owner->GetParent()->GetChildAt(targetIndex);
+            target = Owner->GetParent()->GetChildAt(Record.TargetIndex);
 
         FRelationItem* newItem = new FRelationItem(Owner);
         newItem->SetTarget(target);
         Items.Add(newItem);
 
-        int32 cnt2 = Buffer->ReadByte();
-        for (int32 j = 0; j < cnt2; j++)
-        {
-            ERelationType rt = (ERelationType)Buffer->ReadByte();
-            bool usePercent = Buffer->ReadBool();
-            newItem->InternalAdd(rt, usePercent);
-        }
+        for (const TPair<ERelationType, bool>& Def : Record.Defs)
+            newItem->InternalAdd(Def.Key, Def.Value);
     }
 }
\ No newline at end of file
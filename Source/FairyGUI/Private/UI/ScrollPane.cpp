@@ -89,7 +89,10 @@ void UScrollPane::Setup(FByteBuffer* Buffer)
         bBouncebackEffect = false;
     bInertiaDisabled = (flags & 256) != 0;
     if ((flags & 512) == 0)
+    {
         MaskContainer->SetClipping(EWidgetClipping::ClipToBoundsAlways);
+        MaskContainer->InvalidatePaintBounds();
+    }
     bFloating = (flags & 1024) != 0;
     bDontClipMargin = (flags & 2048) != 0;
 
@@ -492,6 +495,18 @@ void UScrollPane::CancelDragging()
     bDragged = false;
 }
 
+void UScrollPane::SetPageController(UGController* InController)
+{
+    if (PageController == InController)
+        return;
+
+    if (PageController != nullptr)
+        PageController->RemoveSubscriber(Owner);
+    PageController = InController;
+    if (PageController != nullptr)
+        PageController->AddSubscriber(Owner);
+}
+
 void UScrollPane::HandleControllerChanged(UGController* Controller)
 {
     if (PageController == Controller)
@@ -877,7 +892,7 @@ void UScrollPane::UpdateScrollBarVisible2(UGScrollBar* Bar)
     if (bScrollBarDisplayAuto && !bHover && Tweening == 0 && !bDragged && !Bar->bGripDragging)
     {
         if (Bar->IsVisible())
-            FGTween::To(1, 0, 0.5f)
+            FGTween::To(1, 0, 0.5f, Owner)
             ->SetDelay(0.5f)
             ->OnUpdate(FTweenDelegate::CreateStatic(&FGTweenAction::SetAlpha))
             ->OnComplete(FTweenDelegate::CreateUObject(this, &UScrollPane::OnBarTweenComplete))
@@ -1519,6 +1534,13 @@ void UScrollPane::OnTouchMove(UEventContext* Context)
     else if (deltaPosition.Y != 0)
         VelocityScale = FMath::Abs(deltaGlobalPosition.Y / deltaPosition.Y);
 
+    if (UFairyApplication::GetUIConfig().CoalescePointerMoves && VelocityScale > 0)
+    {
+        //only one move per frame arrives here, use the velocity measured from the raw samples
+        FVector2D v = Owner->GetApp()->GetTouchVelocity(Context->GetUserIndex(), (int32)Context->GetPointerIndex()) / VelocityScale;
+        Velocity.Set(sh ? v.X : 0, sv ? v.Y : 0);
+    }
+
     LastTouchPos = pt;
     LastTouchGlobalPos = Context->GetPointerPosition();
     LastMoveTime = GWorld->GetTimeSeconds();
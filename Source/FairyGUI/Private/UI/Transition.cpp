@@ -297,7 +297,7 @@ void UTransition::Play(int32 InTimes, float InDelay, float InStartTime, float In
     if (InDelay == 0)
         OnDelayedPlay();
     else
-        DelayHandle = FGTween::DelayedCall(InDelay)->OnComplete(FSimpleDelegate::CreateUObject(this, &UTransition::OnDelayedPlay))->GetHandle();
+        DelayHandle = FGTween::DelayedCall(InDelay, Owner)->OnComplete(FSimpleDelegate::CreateUObject(this, &UTransition::OnDelayedPlay))->GetHandle();
 }
 
 void UTransition::ChangePlayTimes(int32 InTimes)
@@ -753,20 +753,20 @@ void UTransition::PlayItem(FTransitionItem* item)
             case ETransitionActionType::Size:
             case ETransitionActionType::Scale:
             case ETransitionActionType::Skew:
-                item->Tweener = FGTween::To(startValue->GetVec2(), endValue->GetVec2(), item->TweenConfig->Duration);
+                item->Tweener = FGTween::To(startValue->GetVec2(), endValue->GetVec2(), item->TweenConfig->Duration, Owner);
                 break;
 
             case ETransitionActionType::Alpha:
             case ETransitionActionType::Rotation:
-                item->Tweener = FGTween::To(startValue->f1, endValue->f1, item->TweenConfig->Duration);
+                item->Tweener = FGTween::To(startValue->f1, endValue->f1, item->TweenConfig->Duration, Owner);
                 break;
 
             case ETransitionActionType::Color:
-                item->Tweener = FGTween::To(startValue->GetColor(), endValue->GetColor(), item->TweenConfig->Duration);
+                item->Tweener = FGTween::To(startValue->GetColor(), endValue->GetColor(), item->TweenConfig->Duration, Owner);
                 break;
 
             case ETransitionActionType::ColorFilter:
-                item->Tweener = FGTween::To(startValue->GetVec4(), endValue->GetVec4(), item->TweenConfig->Duration);
+                item->Tweener = FGTween::To(startValue->GetVec4(), endValue->GetVec4(), item->TweenConfig->Duration, Owner);
                 break;
             default:
                 break;
@@ -798,7 +798,7 @@ void UTransition::PlayItem(FTransitionItem* item)
         {
             item->ShakeData->LastOffset.Set(0, 0);
             item->ShakeData->Offset.Set(0, 0);
-            item->Tweener = FGTween::Shake(FVector2D::ZeroVector, item->ShakeData->Amplitude, item->ShakeData->Duration)
+            item->Tweener = FGTween::Shake(FVector2D::ZeroVector, item->ShakeData->Amplitude, item->ShakeData->Duration, Owner)
                 ->SetDelay(time)
                 ->SetTimeScale(TimeScale)
                 ->SetUserData(FNVariant(item))
@@ -827,7 +827,7 @@ void UTransition::PlayItem(FTransitionItem* item)
         else if (EndTime == -1 || time <= EndTime)
         {
             TotalTasks++;
-            item->Tweener = FGTween::DelayedCall(time)
+            item->Tweener = FGTween::DelayedCall(time, Owner)
                 ->SetTimeScale(TimeScale)
                 ->SetUserData(FNVariant(item))
                 ->OnComplete(FTweenDelegate::CreateUObject(this, &UTransition::OnDelayedPlayItem));
@@ -13,6 +13,13 @@ FUIConfig::FUIConfig() :
     TouchScrollSensitivity(20),
     DefaultComboBoxVisibleItemCount(10),
     ModalLayerColor(0, 0, 0, 120),
-    BringWindowToFrontOnClick(true)
+    BringWindowToFrontOnClick(true),
+    PoolPrewarmFrameBudget(0.002f),
+    LayerBatching(false),
+    TweenBackgroundTickRate(10),
+    TweenBackgroundFrameBudget(0.001f),
+    CoalescePointerMoves(false),
+    DeferRelations(false),
+    TextLayoutCacheSize(1024)
 {
 }
\ No newline at end of file
@@ -8,8 +8,14 @@
 #include "Widgets/NTexture.h"
 #include "Widgets/SMovieClip.h"
 #include "Widgets/BitmapFont.h"
+#include "Widgets/TextLayoutCache.h"
+#include "Widgets/GlyphCache.h"
+#include "UI/UIConfig.h"
 #include "Utils/ByteBuffer.h"
 #include "UI/UIObjectFactory.h"
+#include "Async/Async.h"
+#include "Engine/AssetManager.h"
+#include "UObject/StrongObjectPtr.h"
 
 int32 UUIPackage::Constructing = 0;
 
@@ -29,6 +35,70 @@ struct FAtlasSprite
     bool bRotated;
 };
 
+struct FPackageItemDesc
+{
+    EPackageItemType Type = EPackageItemType::Unknown;
+    EObjectType ObjectType = EObjectType::Component;
+    FString ID;
+    FString Name;
+    FString BranchAliasID;
+    FVector2D Size = FVector2D::ZeroVector;
+    FString File;
+    TSharedPtr<FByteBuffer> RawData;
+    TOptional<TArray<FString>> Branches;
+    TOptional<TArray<FString>> HighResolution;
+    TOptional<FBox2D> Scale9Grid;
+    bool bScaleByTile = false;
+    int32 TileGridIndice = 0;
+    TSharedPtr<FPixelHitTestData> PixelHitTestData;
+};
+
+struct FAtlasSpriteDesc
+{
+    FString ItemID;
+    FString AtlasID;
+    FAtlasSprite Sprite;
+};
+
+// Plain-data result of parsing a package, safe to build off the game thread.
+struct FUIPackageIndex
+{
+    bool bValid = false;
+    FString ID;
+    FString Name;
+    TArray<FUIPackageDependency> Dependencies;
+    TArray<FString> Branches;
+    TArray<FPackageItemDesc> Items;
+    TArray<FAtlasSpriteDesc> Sprites;
+    TSharedPtr<FByteBufferStringTable> StringTable;
+};
+
+struct FAsyncPackageLoad
+{
+    TStrongObjectPtr<UUIPackageAsset> Asset;
+    FString AssetPath;
+    TSharedRef<FUIPackageIndex> Index = MakeShared<FUIPackageIndex>();
+    TSharedPtr<FStreamableHandle> StreamingHandle;
+    FUIPackageLoadTimes Times;
+    TArray<FOnUIPackageLoaded> Callbacks;
+};
+
+static TMap<FString, TSharedPtr<FAsyncPackageLoad>> PendingAsyncLoads;
+
+static void FinishAsyncLoad(const TSharedRef<FAsyncPackageLoad>& Pending, UUIPackage* Pkg)
+{
+    PendingAsyncLoads.Remove(Pending->AssetPath);
+
+    if (Pkg == nullptr)
+        UE_LOG(LogFairyGUI, Error, TEXT("failed to load package '%s' asynchronously"), *Pending->AssetPath);
+    else
+        UE_LOG(LogFairyGUI, Verbose, TEXT("package '%s' loaded asynchronously, parse %.2fms, stream %.2fms"),
+            *Pending->AssetPath, Pending->Times.ParseSeconds * 1000, Pending->Times.StreamSeconds * 1000);
+
+    for (FOnUIPackageLoaded& Callback : Pending->Callbacks)
+        Callback.ExecuteIfBound(Pkg, Pending->Times);
+}
+
 const FString& UUIPackage::GetBranch()
 {
     return UFairyApplication::Branch;
@@ -84,12 +154,171 @@ UUIPackage* UUIPackage::AddPackage(UUIPackageAsset* InAsset)
     Pkg->AssetPath = InAsset->GetPathName();
     Pkg->Load(&Buffer);
 
+    Register(Pkg);
+
+    return Pkg;
+}
+
+void UUIPackage::AddPackageAsync(UUIPackageAsset* InAsset, FOnUIPackageLoaded OnLoaded)
+{
+    check(IsInGameThread());
+
+    const FString Path = InAsset->GetPathName();
+    if (UUIPackage* Pkg = UFairyApplication::PackageInstByID.FindRef(Path))
+    {
+        OnLoaded.ExecuteIfBound(Pkg, FUIPackageLoadTimes());
+        return;
+    }
+
+    if (TSharedPtr<FAsyncPackageLoad>* Existing = PendingAsyncLoads.Find(Path))
+    {
+        (*Existing)->Callbacks.Add(MoveTemp(OnLoaded));
+        return;
+    }
+
+    TSharedPtr<FAsyncPackageLoad> Pending = MakeShared<FAsyncPackageLoad>();
+    Pending->Asset.Reset(InAsset);
+    Pending->AssetPath = Path;
+    Pending->Callbacks.Add(MoveTemp(OnLoaded));
+    PendingAsyncLoads.Add(Path, Pending);
+
+    const uint8* Data = InAsset->Data.GetData();
+    const int32 DataLen = InAsset->Data.Num();
+    TSharedRef<FUIPackageIndex> Index = Pending->Index;
+
+    // The asset is kept alive by the pending load, so the worker may read its data without touching the UObject.
+    Async(EAsyncExecution::ThreadPool, [Data, DataLen, Path, Index]()
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        FByteBuffer Buffer(Data, 0, DataLen, false);
+        ParseIndex(&Buffer, Path, *Index);
+        const double ParseSeconds = FPlatformTime::Seconds() - StartTime;
+
+        AsyncTask(ENamedThreads::GameThread, [Path, ParseSeconds]()
+        {
+            TSharedPtr<FAsyncPackageLoad> Pending = PendingAsyncLoads.FindRef(Path);
+            if (!Pending.IsValid())
+                return;
+
+            Pending->Times.ParseSeconds = ParseSeconds;
+            if (!Pending->Index->bValid)
+            {
+                FinishAsyncLoad(Pending.ToSharedRef(), nullptr);
+                return;
+            }
+
+            TArray<FSoftObjectPath> Resources;
+            for (const FPackageItemDesc& Desc : Pending->Index->Items)
+            {
+                if (Desc.Type == EPackageItemType::Atlas || Desc.Type == EPackageItemType::Sound)
+                    Resources.Emplace(Desc.File);
+            }
+
+            const double StreamStartTime = FPlatformTime::Seconds();
+            auto OnStreamed = [Path, StreamStartTime]()
+            {
+                TSharedPtr<FAsyncPackageLoad> Pending = PendingAsyncLoads.FindRef(Path);
+                if (!Pending.IsValid())
+                    return;
+
+                Pending->Times.StreamSeconds += FPlatformTime::Seconds() - StreamStartTime;
+
+                UUIPackage* Pkg = UFairyApplication::PackageInstByID.FindRef(Path);
+                if (Pkg == nullptr)
+                {
+                    Pkg = NewObject<UUIPackage>();
+                    Pkg->Asset = Pending->Asset.Get();
+                    Pkg->AssetPath = Path;
+                    Pkg->StreamingHandle = Pending->StreamingHandle;
+                    Pkg->ApplyIndex(*Pending->Index);
+                    Register(Pkg);
+                }
+                FinishAsyncLoad(Pending.ToSharedRef(), Pkg);
+            };
+
+            if (Resources.Num() > 0)
+            {
+                Pending->StreamingHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Resources), FStreamableDelegate::CreateLambda(OnStreamed));
+                if (!Pending->StreamingHandle.IsValid())
+                    OnStreamed();
+            }
+            else
+                OnStreamed();
+        });
+    });
+}
+
+void UUIPackage::AddPackageByPathAsync(const FString& InAssetPath, FOnUIPackageLoaded OnLoaded)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const FSoftObjectPath SoftObjectPath(InAssetPath);
+
+    UAssetManager::GetStreamableManager().RequestAsyncLoad(SoftObjectPath, FStreamableDelegate::CreateLambda([SoftObjectPath, InAssetPath, StartTime, OnLoaded]()
+    {
+        UUIPackageAsset* PackageAsset = Cast<UUIPackageAsset>(SoftObjectPath.ResolveObject());
+        if (PackageAsset == nullptr)
+        {
+            UE_LOG(LogFairyGUI, Error, TEXT("Asset not found %s"), *InAssetPath);
+            OnLoaded.ExecuteIfBound(nullptr, FUIPackageLoadTimes());
+            return;
+        }
+
+        const double AssetStreamSeconds = FPlatformTime::Seconds() - StartTime;
+        AddPackageAsync(PackageAsset, FOnUIPackageLoaded::CreateLambda([OnLoaded, AssetStreamSeconds](UUIPackage* Pkg, const FUIPackageLoadTimes& Times)
+        {
+            FUIPackageLoadTimes TotalTimes = Times;
+            TotalTimes.StreamSeconds += AssetStreamSeconds;
+            OnLoaded.ExecuteIfBound(Pkg, TotalTimes);
+        }));
+    }));
+}
+
+void UUIPackage::Register(UUIPackage* Pkg)
+{
     UFairyApplication::PackageList.Add(Pkg);
     UFairyApplication::PackageInstByID.Add(Pkg->ID, Pkg);
     UFairyApplication::PackageInstByID.Add(Pkg->AssetPath, Pkg);
     UFairyApplication::PackageInstByName.Add(Pkg->Name, Pkg);
 
-    return Pkg;
+    for (int32 FontSize : UFairyApplication::GetUIConfig().PrewarmFontSizes)
+        Pkg->PrewarmGlyphs(G_EMPTY_STRING, FontSize);
+}
+
+void UUIPackage::PrewarmGlyphs(const FString& FontFace, int32 FontSize)
+{
+    if (!StringTable.IsValid() || FontFace.StartsWith("ui://"))
+        return;
+
+    TSet<TCHAR> Characters;
+    for (int32 i = 0; i < StringTable->Num(); i++)
+    {
+        //translated strings replace the ones in the package data
+        if (StringTable->IsDecoded(i))
+        {
+            for (TCHAR Char : StringTable->Get(i))
+                Characters.Add(Char);
+        }
+        else
+        {
+            FUtf8StringView View = StringTable->GetView(i);
+            FUTF8ToTCHAR Conv(View.GetData(), View.Len());
+            for (int32 j = 0; j < Conv.Length(); j++)
+                Characters.Add(Conv.Get()[j]);
+        }
+    }
+
+    FString Glyphs;
+    Glyphs.Reserve(Characters.Num());
+    for (TCHAR Char : Characters)
+    {
+        if (!FChar::IsWhitespace(Char))
+            Glyphs.AppendChar(Char);
+    }
+
+    FNTextFormat Format;
+    Format.Face = FontFace;
+    Format.Size = FGlyphCache::QuantizeFontSize(FontSize);
+    FGlyphCache::Prewarm(Format.GetStyle().Font, Glyphs);
 }
 
 void UUIPackage::RemovePackage(const FString& IDOrName)
@@ -110,6 +339,9 @@ void UUIPackage::RemovePackage(const FString& IDOrName)
     UFairyApplication::PackageInstByID.Remove(AssetPath);
     UFairyApplication::PackageInstByID.Remove(ID);
     UFairyApplication::PackageInstByName.Remove(Name);
+
+    //cached layouts may hold bitmap fonts of this package
+    FTextLayoutCache::Get().Empty();
 }
 
 void UUIPackage::RemoveAllPackages()
@@ -117,6 +349,8 @@ void UUIPackage::RemoveAllPackages()
     UFairyApplication::PackageList.Reset();
     UFairyApplication::PackageInstByID.Reset();
     UFairyApplication::PackageInstByName.Reset();
+
+    FTextLayoutCache::Get().Empty();
 }
 
 UGObject* UUIPackage::CreateObject(const FString& PackageName, const FString& ResourceName, UObject* WorldContextObject, TSubclassOf<UGObject> ClassType)
@@ -265,18 +499,26 @@ void UUIPackage::RegisterFont(const FString& FontFace, UFont* Font, UObject* Wor
 }
 
 void UUIPackage::Load(FByteBuffer* Buffer)
+{
+    FUIPackageIndex Index;
+    ParseIndex(Buffer, AssetPath, Index);
+    if (Index.bValid)
+        ApplyIndex(Index);
+}
+
+void UUIPackage::ParseIndex(FByteBuffer* Buffer, const FString& InAssetPath, FUIPackageIndex& OutIndex)
 {
     if (Buffer->ReadUint() != 0x46475549)
     {
-        UE_LOG(LogFairyGUI, Error, TEXT("not valid package format in %d '%s'"), Buffer->ReadUint(), *AssetPath);
+        UE_LOG(LogFairyGUI, Error, TEXT("not valid package format in '%s'"), *InAssetPath);
         return;
     }
 
     Buffer->Version = Buffer->ReadInt();
     bool ver2 = Buffer->Version >= 2;
     Buffer->ReadBool(); //compressed
-    ID = Buffer->ReadString();
-    Name = Buffer->ReadString();
+    OutIndex.ID = Buffer->ReadString();
+    OutIndex.Name = Buffer->ReadString();
     Buffer->Skip(20);
     int32 indexTablePos = Buffer->GetPos();
     int32 cnt;
@@ -284,13 +526,8 @@ void UUIPackage::Load(FByteBuffer* Buffer)
     Buffer->Seek(indexTablePos, 4);
 
     cnt = Buffer->ReadInt();
-    TArray<FString>* StringTable = new TArray<FString>();
-    StringTable->SetNum(cnt, EAllowShrinking::Yes);
-    for (int32 i = 0; i < cnt; i++)
-    {
-        (*StringTable)[i] = Buffer->ReadString();
-    }
-    Buffer->StringTable = MakeShareable(StringTable);
+    Buffer->ReadStringTable(cnt);
+    OutIndex.StringTable = Buffer->StringTable;
 
     Buffer->Seek(indexTablePos, 0);
     cnt = Buffer->ReadShort();
@@ -300,7 +537,7 @@ void UUIPackage::Load(FByteBuffer* Buffer)
         Dependency.Id = Buffer->ReadS();
         Dependency.Name = Buffer->ReadS();
 
-        Dependencies.Push(Dependency);
+        OutIndex.Dependencies.Push(Dependency);
     }
 
     bool branchIncluded = false;
@@ -308,42 +545,39 @@ void UUIPackage::Load(FByteBuffer* Buffer)
     {
         cnt = Buffer->ReadShort();
         if (cnt > 0)
-        {
-            Buffer->ReadSArray(Branches, cnt);
-            if (!UFairyApplication::Get(this)->Branch.IsEmpty())
-                BranchIndex = Branches.Find(UFairyApplication::Get(this)->Branch);
-        }
+            Buffer->ReadSArray(OutIndex.Branches, cnt);
 
         branchIncluded = cnt > 0;
     }
 
     Buffer->Seek(indexTablePos, 1);
 
-    FString path = FPaths::GetPath(AssetPath);
-    FString fileName = FPaths::GetBaseFilename(AssetPath);
+    FString path = FPaths::GetPath(InAssetPath);
+    FString fileName = FPaths::GetBaseFilename(InAssetPath);
+    TMap<FString, int32> ItemIndexByID;
 
     cnt = Buffer->ReadShort();
+    OutIndex.Items.Reserve(cnt);
     for (int32 i = 0; i < cnt; i++)
     {
         int32 nextPos = Buffer->ReadInt();
         nextPos += Buffer->GetPos();
 
-        TSharedPtr<FPackageItem> pii = MakeShared<FPackageItem>();
-        pii->Owner = this;
-        pii->Type = (EPackageItemType)Buffer->ReadByte();
-        pii->ID = Buffer->ReadS();
-        pii->Name = Buffer->ReadS();
+        FPackageItemDesc& pii = OutIndex.Items.AddDefaulted_GetRef();
+        pii.Type = (EPackageItemType)Buffer->ReadByte();
+        pii.ID = Buffer->ReadS();
+        pii.Name = Buffer->ReadS();
         Buffer->Skip(2); //path
-        pii->File = Buffer->ReadS();
+        pii.File = Buffer->ReadS();
         Buffer->ReadBool(); //exported
-        pii->Size.X = Buffer->ReadInt();
-        pii->Size.Y = Buffer->ReadInt();
+        pii.Size.X = Buffer->ReadInt();
+        pii.Size.Y = Buffer->ReadInt();
 
-        switch (pii->Type)
+        switch (pii.Type)
         {
         case EPackageItemType::Image:
         {
-            pii->ObjectType = EObjectType::Image;
+            pii.ObjectType = EObjectType::Image;
             int32 scaleOption = Buffer->ReadByte();
             if (scaleOption == 1)
             {
@@ -352,11 +586,11 @@ void UUIPackage::Load(FByteBuffer* Buffer)
                 scale9Grid.Min.Y = Buffer->ReadInt();
                 scale9Grid.Max.X = scale9Grid.Min.X + Buffer->ReadInt();
                 scale9Grid.Max.Y = scale9Grid.Min.Y + Buffer->ReadInt();
-                pii->Scale9Grid = scale9Grid;
-                pii->TileGridIndice = Buffer->ReadInt();
+                pii.Scale9Grid = scale9Grid;
+                pii.TileGridIndice = Buffer->ReadInt();
             }
             else if (scaleOption == 2)
-                pii->bScaleByTile = true;
+                pii.bScaleByTile = true;
 
             Buffer->ReadBool(); //smoothing
             break;
@@ -365,14 +599,14 @@ void UUIPackage::Load(FByteBuffer* Buffer)
         case EPackageItemType::MovieClip:
         {
             Buffer->ReadBool(); //smoothing
-            pii->ObjectType = EObjectType::MovieClip;
-            pii->RawData = Buffer->ReadBuffer(false);
+            pii.ObjectType = EObjectType::MovieClip;
+            pii.RawData = Buffer->ReadBuffer(false);
             break;
         }
 
         case EPackageItemType::Font:
         {
-            pii->RawData = Buffer->ReadBuffer(false);
+            pii.RawData = Buffer->ReadBuffer(false);
             break;
         }
 
@@ -380,12 +614,10 @@ void UUIPackage::Load(FByteBuffer* Buffer)
         {
             int32 extension = Buffer->ReadByte();
             if (extension > 0)
-                pii->ObjectType = (EObjectType)extension;
+                pii.ObjectType = (EObjectType)extension;
             else
-                pii->ObjectType = EObjectType::Component;
-            pii->RawData = Buffer->ReadBuffer(false);
-
-            FUIObjectFactory::ResolvePackageItemExtension(pii);
+                pii.ObjectType = EObjectType::Component;
+            pii.RawData = Buffer->ReadBuffer(false);
             break;
         }
 
@@ -393,15 +625,15 @@ void UUIPackage::Load(FByteBuffer* Buffer)
         case EPackageItemType::Sound:
         case EPackageItemType::Misc:
         {
-            FString file = fileName + "_" + FPaths::GetBaseFilename(pii->File);
-            pii->File = path + "/" + file + "." + file;
+            FString file = fileName + "_" + FPaths::GetBaseFilename(pii.File);
+            pii.File = path + "/" + file + "." + file;
             break;
         }
 
         case EPackageItemType::Spine:
         case EPackageItemType::DragonBones:
         {
-            pii->File = path + pii->File;
+            pii.File = path + pii.File;
             break;
         }
 
@@ -413,32 +645,31 @@ void UUIPackage::Load(FByteBuffer* Buffer)
         {
             FString str = Buffer->ReadS(); //branch
             if (!str.IsEmpty())
-                pii->Name = str + "/" + pii->Name;
+                pii.Name = str + "/" + pii.Name;
 
             int32 branchCnt = Buffer->ReadUbyte();
             if (branchCnt > 0)
             {
                 if (branchIncluded)
                 {
-                    pii->Branches.Emplace();
-                    Buffer->ReadSArray(pii->Branches.GetValue(), branchCnt);
+                    pii.Branches.Emplace();
+                    Buffer->ReadSArray(pii.Branches.GetValue(), branchCnt);
                 }
                 else
-                    ItemsByID.Add(Buffer->ReadS(), pii);
+                    pii.BranchAliasID = Buffer->ReadS();
             }
 
             int32 highResCnt = Buffer->ReadUbyte();
             if (highResCnt > 0)
             {
-                pii->HighResolution.Emplace();
-                Buffer->ReadSArray(pii->HighResolution.GetValue(), highResCnt);
+                pii.HighResolution.Emplace();
+                Buffer->ReadSArray(pii.HighResolution.GetValue(), highResCnt);
             }
         }
 
-        Items.Push(pii);
-        ItemsByID.Add(pii->ID, pii);
-        if (!pii->Name.IsEmpty())
-            ItemsByName.Add(pii->Name, pii);
+        if (!pii.BranchAliasID.IsEmpty())
+            ItemIndexByID.Add(pii.BranchAliasID, i);
+        ItemIndexByID.Add(pii.ID, i);
 
         Buffer->SetPos(nextPos);
     }
@@ -446,16 +677,17 @@ void UUIPackage::Load(FByteBuffer* Buffer)
     Buffer->Seek(indexTablePos, 2);
 
     cnt = Buffer->ReadShort();
+    OutIndex.Sprites.Reserve(cnt);
     for (int32 i = 0; i < cnt; i++)
     {
         int32 nextPos = Buffer->ReadShort();
         nextPos += Buffer->GetPos();
 
-        const FString& itemId = Buffer->ReadS();
-        const TSharedPtr<FPackageItem>& pii = ItemsByID[Buffer->ReadS()];
+        FAtlasSpriteDesc& Desc = OutIndex.Sprites.AddDefaulted_GetRef();
+        Desc.ItemID = Buffer->ReadS();
+        Desc.AtlasID = Buffer->ReadS();
 
-        FAtlasSprite* sprite = new FAtlasSprite();
-        sprite->Atlas = pii;
+        FAtlasSprite* sprite = &Desc.Sprite;
         sprite->Rect.Min.X = Buffer->ReadInt();
         sprite->Rect.Min.Y = Buffer->ReadInt();
         sprite->Rect.Max.X = sprite->Rect.Min.X + Buffer->ReadInt();
@@ -479,7 +711,6 @@ void UUIPackage::Load(FByteBuffer* Buffer)
             sprite->Offset.Set(0, 0);
             sprite->OriginalSize = sprite->Rect.GetSize();
         }
-        Sprites.Add(itemId, sprite);
 
         Buffer->SetPos(nextPos);
     }
@@ -492,16 +723,68 @@ void UUIPackage::Load(FByteBuffer* Buffer)
             int32 nextPos = Buffer->ReadInt();
             nextPos += Buffer->GetPos();
 
-            TSharedPtr<FPackageItem> pii = ItemsByID.FindRef(Buffer->ReadS());
-            if (pii.IsValid() && pii->Type == EPackageItemType::Image)
+            const int32* ItemIndex = ItemIndexByID.Find(Buffer->ReadS());
+            if (ItemIndex != nullptr && OutIndex.Items[*ItemIndex].Type == EPackageItemType::Image)
             {
-                pii->PixelHitTestData = MakeShareable(new FPixelHitTestData());
-                pii->PixelHitTestData->Load(Buffer);
+                FPackageItemDesc& pii = OutIndex.Items[*ItemIndex];
+                pii.PixelHitTestData = MakeShareable(new FPixelHitTestData());
+                pii.PixelHitTestData->Load(Buffer);
             }
 
             Buffer->SetPos(nextPos);
         }
     }
+
+    OutIndex.bValid = true;
+}
+
+void UUIPackage::ApplyIndex(FUIPackageIndex& Index)
+{
+    ID = MoveTemp(Index.ID);
+    Name = MoveTemp(Index.Name);
+    Dependencies = MoveTemp(Index.Dependencies);
+    Branches = MoveTemp(Index.Branches);
+    StringTable = MoveTemp(Index.StringTable);
+    if (Branches.Num() > 0 && !UFairyApplication::Branch.IsEmpty())
+        BranchIndex = Branches.Find(UFairyApplication::Branch);
+
+    Items.Reserve(Index.Items.Num());
+    for (FPackageItemDesc& Desc : Index.Items)
+    {
+        TSharedPtr<FPackageItem> pii = MakeShared<FPackageItem>();
+        pii->Owner = this;
+        pii->Type = Desc.Type;
+        pii->ObjectType = Desc.ObjectType;
+        pii->ID = MoveTemp(Desc.ID);
+        pii->Name = MoveTemp(Desc.Name);
+        pii->Size = Desc.Size;
+        pii->File = MoveTemp(Desc.File);
+        pii->RawData = MoveTemp(Desc.RawData);
+        pii->Branches = MoveTemp(Desc.Branches);
+        pii->HighResolution = MoveTemp(Desc.HighResolution);
+        pii->Scale9Grid = Desc.Scale9Grid;
+        pii->bScaleByTile = Desc.bScaleByTile;
+        pii->TileGridIndice = Desc.TileGridIndice;
+        pii->PixelHitTestData = MoveTemp(Desc.PixelHitTestData);
+
+        if (pii->Type == EPackageItemType::Component)
+            FUIObjectFactory::ResolvePackageItemExtension(pii);
+
+        if (!Desc.BranchAliasID.IsEmpty())
+            ItemsByID.Add(Desc.BranchAliasID, pii);
+
+        Items.Push(pii);
+        ItemsByID.Add(pii->ID, pii);
+        if (!pii->Name.IsEmpty())
+            ItemsByName.Add(pii->Name, pii);
+    }
+
+    for (FAtlasSpriteDesc& Desc : Index.Sprites)
+    {
+        FAtlasSprite* sprite = new FAtlasSprite(Desc.Sprite);
+        sprite->Atlas = ItemsByID[Desc.AtlasID];
+        Sprites.Add(Desc.ItemID, sprite);
+    }
 }
 
 void* UUIPackage::GetItemAsset(const TSharedPtr<FPackageItem>& Item)
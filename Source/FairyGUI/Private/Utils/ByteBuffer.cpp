@@ -1,5 +1,47 @@
 #include "Utils/ByteBuffer.h"
 
+FByteBufferStringTable::FByteBufferStringTable(const uint8* InData, int32 InCount)
+    : Data(InData)
+{
+    Entries.Reserve(InCount);
+}
+
+void FByteBufferStringTable::Add(int32 InOffset, int32 InLength)
+{
+    Entries.Add({ InOffset, InLength });
+    Strings.AddDefaulted();
+    Decoded.Add(false);
+}
+
+const FString& FByteBufferStringTable::Get(int32 Index)
+{
+    FString& Str = Strings[Index];
+    if (!Decoded[Index])
+    {
+        Decoded[Index] = true;
+        const FEntry& Entry = Entries[Index];
+        if (Entry.Length > 0)
+        {
+            FUTF8ToTCHAR Conv((const UTF8CHAR*)(Data + Entry.Offset), Entry.Length);
+            Str = FString(Conv.Length(), Conv.Get());
+        }
+    }
+    return Str;
+}
+
+FUtf8StringView FByteBufferStringTable::GetView(int32 Index) const
+{
+    checkf(!Decoded[Index], TEXT("String %d was replaced, its view would return the original bytes"), Index);
+    const FEntry& Entry = Entries[Index];
+    return FUtf8StringView((const UTF8CHAR*)(Data + Entry.Offset), Entry.Length);
+}
+
+void FByteBufferStringTable::Set(int32 Index, const FString& InString)
+{
+    Strings[Index] = InString;
+    Decoded[Index] = true;
+}
+
 FByteBuffer::FByteBuffer(const uint8* InBuffer, int32 InOffset, int32 InLen, bool bInTransferOwnerShip)
     : bLittleEndian(false),
     Version(0),
@@ -107,7 +149,7 @@ const FString& FByteBuffer::ReadS()
     if (index == 65534 || index == 65533)
         return G_EMPTY_STRING;
     else
-        return (*StringTable)[index];
+        return StringTable->Get(index);
 }
 
 bool FByteBuffer::ReadS(FString& OutString)
@@ -122,7 +164,7 @@ bool FByteBuffer::ReadS(FString& OutString)
     }
     else
     {
-        OutString = (*StringTable)[index];
+        OutString = StringTable->Get(index);
         return true;
     }
 }
@@ -135,7 +177,7 @@ const FString* FByteBuffer::ReadSP()
     else if (index == 65533)
         return &G_EMPTY_STRING;
     else
-        return &(*StringTable)[index];
+        return &StringTable->Get(index);
 }
 
 void FByteBuffer::ReadSArray(TArray<FString>& OutArray, int32 InCount)
@@ -148,7 +190,18 @@ void FByteBuffer::WriteS(const FString& InString)
 {
     uint16 index = ReadUshort();
     if (index != 65534 && index != 65533)
-        (*StringTable)[index] = InString;
+        StringTable->Set(index, InString);
+}
+
+void FByteBuffer::ReadStringTable(int32 InCount)
+{
+    StringTable = MakeShared<FByteBufferStringTable>(Buffer, InCount);
+    for (int32 i = 0; i < InCount; i++)
+    {
+        int32 len = ReadUshort();
+        StringTable->Add(Offset + Position, len);
+        Position += len;
+    }
 }
 
 FColor FByteBuffer::ReadColor()
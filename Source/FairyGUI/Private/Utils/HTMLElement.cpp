@@ -1 +1,15 @@
 #include "Utils/HTMLElement.h"
+
+FHTMLElement& FHTMLElementArena::Add(EHTMLElementType Type)
+{
+    if (NumElements == Elements.Num())
+        Elements.AddDefaulted();
+
+    FHTMLElement& Element = Elements[NumElements++];
+    Element.Type = Type;
+    Element.Name.Reset();
+    Element.Text.Reset();
+    Element.Format = FNTextFormat();
+    Element.Attributes.Reset();
+    return Element;
+}
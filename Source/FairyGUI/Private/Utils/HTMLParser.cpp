@@ -8,14 +8,17 @@ enum class SupportedTagNames {
 FHTMLParser FHTMLParser::DefaultParser;
 FHTMLParseOptions FHTMLParser::DefaultParseOptions;
 
-FHTMLParser::FHTMLParser()
+FHTMLParser::FHTMLParser() :
+    Elements(nullptr),
+    FirstElement(0)
 {
 }
 
-void FHTMLParser::Parse(const FString& InText, const FNTextFormat& InFormat, TArray<FHTMLElement>& OutElements, const FHTMLParseOptions& InParseOptions)
+void FHTMLParser::Parse(const FString& InText, const FNTextFormat& InFormat, FHTMLElementArena& OutElements, const FHTMLParseOptions& InParseOptions)
 {
     ParseOptions = InParseOptions;
     Elements = &OutElements;
+    FirstElement = OutElements.Num();
     TextFormatStack.Reset();
     (FNTextFormat&)Format = InFormat;
     Format.bColorChanged = false;
@@ -139,12 +142,10 @@ void FHTMLParser::Parse(const FString& InText, const FNTextFormat& InFormat, TAr
             {
                 XMLIterator.ParseAttributes();
 
-                FHTMLElement element;
-                element.Type = EHTMLElementType::Image;
+                FHTMLElement& element = Elements->Add(EHTMLElementType::Image);
                 element.Attributes.Append(XMLIterator.Attributes);
                 element.Name = element.Attributes.Get("name");
                 element.Format.Align = Format.Align;
-                Elements->Add(MoveTemp(element));
             }
             break;
 
@@ -157,33 +158,27 @@ void FHTMLParser::Parse(const FString& InText, const FNTextFormat& InFormat, TAr
                 if (!Format.bColorChanged && ParseOptions.LinkColor.A != 0)
                     Format.Color = ParseOptions.LinkColor;
 
-                FHTMLElement element;
-                element.Type = EHTMLElementType::Link;
+                FHTMLElement& element = Elements->Add(EHTMLElementType::Link);
                 XMLIterator.ParseAttributes();
                 element.Attributes.Append(XMLIterator.Attributes);
                 element.Name = element.Attributes.Get("name");
                 element.Format.Align = Format.Align;
-                Elements->Add(MoveTemp(element));
             }
             else if (XMLIterator.TagType == EXMLTagType::End)
             {
                 PopTextFormat();
 
-                FHTMLElement element;
-                element.Type = EHTMLElementType::LinkEnd;
-                Elements->Add(MoveTemp(element));
+                Elements->Add(EHTMLElementType::LinkEnd);
             }
             break;
 
         case SupportedTagNames::INPUT:
         {
-            FHTMLElement element;
-            element.Type = EHTMLElementType::Input;
+            FHTMLElement& element = Elements->Add(EHTMLElementType::Input);
             XMLIterator.ParseAttributes();
             element.Attributes.Append(XMLIterator.Attributes);
             element.Name = element.Attributes.Get("name");
             element.Format = Format;
-            Elements->Add(element);
         }
         break;
 
@@ -191,8 +186,7 @@ void FHTMLParser::Parse(const FString& InText, const FNTextFormat& InFormat, TAr
         {
             if (XMLIterator.TagType == EXMLTagType::Start || XMLIterator.TagType == EXMLTagType::Void)
             {
-                FHTMLElement element;
-                element.Type = EHTMLElementType::Select;
+                FHTMLElement& element = Elements->Add(EHTMLElementType::Select);
                 XMLIterator.ParseAttributes();
                 if (XMLIterator.TagType == EXMLTagType::Start)
                 {
@@ -223,7 +217,6 @@ void FHTMLParser::Parse(const FString& InText, const FNTextFormat& InFormat, TAr
                 }
                 element.Name = element.Attributes.Get("name");
                 element.Format = Format;
-                Elements->Add(element);
             }
         }
         break;
@@ -307,7 +300,7 @@ void FHTMLParser::PopTextFormat()
 
 bool FHTMLParser::IsNewLine()
 {
-    if (Elements->Num() > 0)
+    if (Elements->Num() > FirstElement)
     {
         const FHTMLElement& element = Elements->Last();
         if (element.Type == EHTMLElementType::Text)
@@ -321,7 +314,7 @@ bool FHTMLParser::IsNewLine()
 
 void FHTMLParser::AppendText(const FString& Text)
 {
-    if (Elements->Num() > 0)
+    if (Elements->Num() > FirstElement)
     {
         FHTMLElement& element = Elements->Last();
         if (element.Type == EHTMLElementType::Text && element.Format.EqualStyle(Format))
@@ -331,11 +324,7 @@ void FHTMLParser::AppendText(const FString& Text)
         }
     }
 
-    {
-        FHTMLElement element;
-        element.Type = EHTMLElementType::Text;
-        element.Text = Text;
-        element.Format = Format;
-        Elements->Add(element);
-    }
+    FHTMLElement& element = Elements->Add(EHTMLElementType::Text);
+    element.Text.Append(Text);
+    element.Format = Format;
 }
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "Utils/PrefixSumIndex.h"
+
+FPrefixSumIndex::FPrefixSumIndex() :
+    HighBit(0)
+{
+}
+
+void FPrefixSumIndex::Build(int32 InNum, TFunctionRef<double(int32)> GetValue)
+{
+    Values.SetNumUninitialized(InNum);
+    Tree.SetNumUninitialized(InNum + 1);
+    Tree[0] = 0;
+    for (int32 i = 0; i < InNum; i++)
+    {
+        Values[i] = GetValue(i);
+        Tree[i + 1] = Values[i];
+    }
+
+    for (int32 i = 1; i <= InNum; i++)
+    {
+        int32 Parent = i + (i & -i);
+        if (Parent <= InNum)
+            Tree[Parent] += Tree[i];
+    }
+
+    HighBit = InNum > 0 ? 1 << FMath::FloorLog2(InNum) : 0;
+}
+
+void FPrefixSumIndex::SetValue(int32 Index, double Value)
+{
+    double Delta = Value - Values[Index];
+    if (Delta == 0)
+        return;
+
+    Values[Index] = Value;
+    int32 Count = Values.Num();
+    for (int32 i = Index + 1; i <= Count; i += i & -i)
+        Tree[i] += Delta;
+}
+
+double FPrefixSumIndex::GetPrefixSum(int32 Count) const
+{
+    double Sum = 0;
+    for (int32 i = Count; i > 0; i -= i & -i)
+        Sum += Tree[i];
+    return Sum;
+}
+
+int32 FPrefixSumIndex::FindCount(double Offset) const
+{
+    int32 Pos = 0;
+    int32 Count = Values.Num();
+    for (int32 Step = HighBit; Step > 0; Step >>= 1)
+    {
+        int32 Next = Pos + Step;
+        if (Next <= Count && Tree[Next] <= Offset)
+        {
+            Pos = Next;
+            Offset -= Tree[Next];
+        }
+    }
+    return Pos;
+}
@@ -24,6 +24,9 @@ FUBBParser::FUBBParser() :
     Handlers.Add("font", FTagHandler::CreateRaw(this, &FUBBParser::OnTag_FONT));
     Handlers.Add("size", FTagHandler::CreateRaw(this, &FUBBParser::OnTag_SIZE));
     Handlers.Add("align", FTagHandler::CreateRaw(this, &FUBBParser::OnTag_ALIGN));
+
+    for (auto& it : Handlers)
+        NativeHandlers.Add(it.Key, it.Value.GetHandle());
 }
 
 FUBBParser::~FUBBParser()
@@ -113,6 +116,346 @@ FString FUBBParser::Parse(const FString& Text, bool bRemove)
     }
 }
 
+namespace
+{
+    int32 FindCharFrom(FStringView Text, TCHAR Char, int32 StartIndex)
+    {
+        int32 Index;
+        if (Text.RightChop(StartIndex).FindChar(Char, Index))
+            return StartIndex + Index;
+        else
+            return INDEX_NONE;
+    }
+
+    //the part of FNTextFormat the ubb tags can change, so the format stack carries no strings
+    struct FUBBTextState
+    {
+        int32 Size;
+        FColor Color;
+        EAlignType Align;
+        bool bBold;
+        bool bItalic;
+        bool bUnderline;
+        bool bColorChanged;
+
+        bool EqualStyle(const FNTextFormat& Format) const
+        {
+            return Size == Format.Size && Color == Format.Color
+                && bBold == Format.bBold && bUnderline == Format.bUnderline
+                && bItalic == Format.bItalic
+                && Align == Format.Align;
+        }
+    };
+
+    class FUBBElementWriter
+    {
+    public:
+        FUBBElementWriter(const FNTextFormat& InFormat, FHTMLElementArena& InElements) :
+            BaseFormat(InFormat),
+            Elements(InElements),
+            FirstElement(InElements.Num()),
+            bSkipNextCR(false)
+        {
+            State.Size = InFormat.Size;
+            State.Color = InFormat.Color;
+            State.Align = InFormat.Align;
+            State.bBold = InFormat.bBold;
+            State.bItalic = InFormat.bItalic;
+            State.bUnderline = InFormat.bUnderline;
+            State.bColorChanged = false;
+        }
+
+        void Push()
+        {
+            Stack.Add(State);
+        }
+
+        void Pop()
+        {
+            if (Stack.Num() > 0)
+                State = Stack.Pop();
+        }
+
+        bool IsNewLine() const
+        {
+            if (Elements.Num() > FirstElement)
+            {
+                const FHTMLElement& Element = Elements[Elements.Num() - 1];
+                if (Element.Type == EHTMLElementType::Text)
+                    return Element.Text.EndsWith(TEXT("\n"));
+                else
+                    return false;
+            }
+
+            return true;
+        }
+
+        void AppendText(FStringView Text)
+        {
+            if (bSkipNextCR && Text.Len() > 0 && Text[0] == '\n')
+                Text.RightChopInline(1);
+            if (Text.Len() == 0)
+                return;
+            bSkipNextCR = false;
+
+            if (Elements.Num() > FirstElement)
+            {
+                FHTMLElement& Element = Elements.Last();
+                if (Element.Type == EHTMLElementType::Text && State.EqualStyle(Element.Format))
+                {
+                    Element.Text.Append(Text.GetData(), Text.Len());
+                    return;
+                }
+            }
+
+            FHTMLElement& Element = Elements.Add(EHTMLElementType::Text);
+            Element.Text.Append(Text.GetData(), Text.Len());
+            Element.Format = GetFormat();
+        }
+
+        FHTMLElement& AddElement(EHTMLElementType Type)
+        {
+            FHTMLElement& Element = Elements.Add(Type);
+            Element.Format.Align = State.Align;
+            return Element;
+        }
+
+        FNTextFormat GetFormat() const
+        {
+            FNTextFormat Format = BaseFormat;
+            Format.Size = State.Size;
+            Format.Color = State.Color;
+            Format.Align = State.Align;
+            Format.bBold = State.bBold;
+            Format.bItalic = State.bItalic;
+            Format.bUnderline = State.bUnderline;
+            return Format;
+        }
+
+        FUBBTextState State;
+        bool bSkipNextCR;
+
+    private:
+        const FNTextFormat& BaseFormat;
+        FHTMLElementArena& Elements;
+        int32 FirstElement;
+        TArray<FUBBTextState, TInlineAllocator<16>> Stack;
+    };
+}
+
+bool FUBBParser::ParseElements(FStringView Text, const FNTextFormat& InFormat, FHTMLElementArena& OutElements, const FHTMLParseOptions& InParseOptions)
+{
+    if (HasCustomHandlers())
+        return false;
+
+    int32 Index;
+    if (Text.FindChar('<', Index) || Text.FindChar('&', Index))
+        return false;
+
+    LastColor.Reset();
+    LastFontSize.Reset();
+
+    FUBBElementWriter Writer(InFormat, OutElements);
+    int32 pos1 = 0, pos2, pos3;
+    bool bEnd;
+
+    while ((pos2 = FindCharFrom(Text, '[', pos1)) != INDEX_NONE)
+    {
+        if (pos2 > 0 && Text[pos2 - 1] == '\\')
+        {
+            Writer.AppendText(Text.Mid(pos1, pos2 - pos1 - 1));
+            Writer.AppendText(TEXTVIEW("["));
+            pos1 = pos2 + 1;
+            continue;
+        }
+
+        Writer.AppendText(Text.Mid(pos1, pos2 - pos1));
+        pos1 = pos2;
+        pos2 = FindCharFrom(Text, ']', pos1);
+        if (pos2 == INDEX_NONE)
+            break;
+
+        if (pos2 == pos1 + 1)
+        {
+            Writer.AppendText(Text.Mid(pos1, 2));
+            pos1 = pos2 + 1;
+            continue;
+        }
+
+        bEnd = Text[pos1 + 1] == '/';
+        pos3 = bEnd ? pos1 + 2 : pos1 + 1;
+        FStringView Tag = Text.Mid(pos3, pos2 - pos3);
+        FStringView Attr;
+        ReadPos = pos2 + 1;
+        if (Tag.FindChar('=', pos3))
+        {
+            Attr = Tag.Mid(pos3 + 1);
+            Tag = Tag.Left(pos3);
+        }
+
+        if (Tag.Equals(TEXT("b"), ESearchCase::IgnoreCase) || Tag.Equals(TEXT("i"), ESearchCase::IgnoreCase) || Tag.Equals(TEXT("u"), ESearchCase::IgnoreCase))
+        {
+            Writer.bSkipNextCR = false;
+            if (!bEnd)
+            {
+                Writer.Push();
+                const TCHAR Style = FChar::ToLower(Tag[0]);
+                if (Style == 'b')
+                    Writer.State.bBold = true;
+                else if (Style == 'i')
+                    Writer.State.bItalic = true;
+                else
+                    Writer.State.bUnderline = true;
+            }
+            else
+                Writer.Pop();
+        }
+        else if (Tag.Equals(TEXT("color"), ESearchCase::IgnoreCase) || Tag.Equals(TEXT("size"), ESearchCase::IgnoreCase) || Tag.Equals(TEXT("font"), ESearchCase::IgnoreCase))
+        {
+            Writer.bSkipNextCR = false;
+            if (!bEnd)
+            {
+                Writer.Push();
+                const TCHAR Kind = FChar::ToLower(Tag[0]);
+                if (Kind == 'c')
+                {
+                    LastColor = FString(Attr);
+                    if (Attr.Len() > 0)
+                    {
+                        Writer.State.Color = FColor::FromHex(LastColor);
+                        Writer.State.bColorChanged = true;
+                    }
+                }
+                else if (Kind == 's')
+                {
+                    LastFontSize = FString(Attr);
+                    if (Attr.Len() > 0)
+                        Writer.State.Size = FCString::Atoi(*LastFontSize);
+                }
+                //font faces are not applied by the html path either
+            }
+            else
+                Writer.Pop();
+        }
+        else if (Tag.Equals(TEXT("url"), ESearchCase::IgnoreCase))
+        {
+            Writer.bSkipNextCR = false;
+            if (!bEnd)
+            {
+                Writer.Push();
+                Writer.State.bUnderline = Writer.State.bUnderline || InParseOptions.bLinkUnderline;
+                if (!Writer.State.bColorChanged && InParseOptions.LinkColor.A != 0)
+                    Writer.State.Color = InParseOptions.LinkColor;
+
+                FHTMLElement& Element = Writer.AddElement(EHTMLElementType::Link);
+                Element.Attributes.Add(TEXT("href"), Attr.Len() > 0 ? FString(Attr) : GetTagText(Text, false));
+                Element.Attributes.Add(TEXT("target"), TEXT("_blank"));
+            }
+            else
+            {
+                Writer.Pop();
+                Writer.AddElement(EHTMLElementType::LinkEnd);
+            }
+        }
+        else if (Tag.Equals(TEXT("img"), ESearchCase::IgnoreCase))
+        {
+            if (!bEnd)
+            {
+                FString Src = GetTagText(Text, true);
+                if (!Src.IsEmpty())
+                {
+                    Writer.bSkipNextCR = false;
+                    FHTMLElement& Element = Writer.AddElement(EHTMLElementType::Image);
+                    Element.Attributes.Add(TEXT("src"), MoveTemp(Src));
+                    if (DefaultImgWidth != 0)
+                    {
+                        Element.Attributes.Add(TEXT("width"), FString::FromInt(DefaultImgWidth));
+                        Element.Attributes.Add(TEXT("height"), FString::FromInt(DefaultImgHeight));
+                    }
+                }
+            }
+        }
+        else if (Tag.Equals(TEXT("align"), ESearchCase::IgnoreCase))
+        {
+            Writer.bSkipNextCR = false;
+            if (!bEnd)
+            {
+                Writer.Push();
+                if (Attr.Equals(TEXT("center"), ESearchCase::IgnoreCase))
+                    Writer.State.Align = EAlignType::Center;
+                else if (Attr.Equals(TEXT("right"), ESearchCase::IgnoreCase))
+                    Writer.State.Align = EAlignType::Right;
+
+                if (!Writer.IsNewLine())
+                    Writer.AppendText(TEXTVIEW("\n"));
+            }
+            else
+            {
+                Writer.AppendText(TEXTVIEW("\n"));
+                Writer.bSkipNextCR = true;
+                Writer.Pop();
+            }
+        }
+        else if (Tag.Equals(TEXT("sup"), ESearchCase::IgnoreCase) || Tag.Equals(TEXT("sub"), ESearchCase::IgnoreCase))
+        {
+            Writer.bSkipNextCR = false;
+        }
+        else
+        {
+            Writer.AppendText(Text.Mid(pos1, pos2 - pos1 + 1));
+        }
+        pos1 = ReadPos;
+    }
+
+    if (pos1 < Text.Len())
+        Writer.AppendText(Text.Mid(pos1));
+
+    return true;
+}
+
+bool FUBBParser::HasCustomHandlers() const
+{
+    if (DefaultTagHandler.IsBound() || Handlers.Num() != NativeHandlers.Num())
+        return true;
+
+    for (auto& it : NativeHandlers)
+    {
+        const FTagHandler* Handler = Handlers.Find(it.Key);
+        if (Handler == nullptr || Handler->GetHandle() != it.Value)
+            return true;
+    }
+
+    return false;
+}
+
+FString FUBBParser::GetTagText(FStringView Text, bool bRemove)
+{
+    int32 pos1 = ReadPos;
+    int32 pos2;
+    FString buffer;
+    while ((pos2 = FindCharFrom(Text, '[', pos1)) != INDEX_NONE)
+    {
+        if (Text[pos2 - 1] == '\\')
+        {
+            buffer.Append(Text.GetData() + pos1, pos2 - pos1 - 1);
+            buffer.Append(LEFT_BRACKET);
+            pos1 = pos2 + 1;
+        }
+        else
+        {
+            buffer.Append(Text.GetData() + pos1, pos2 - pos1);
+            break;
+        }
+    }
+    if (pos2 == INDEX_NONE)
+        return G_EMPTY_STRING;
+
+    if (bRemove)
+        ReadPos = pos2;
+
+    return buffer;
+}
+
 FString FUBBParser::GetTagText(bool bRemove)
 {
     int32 pos1 = ReadPos;
@@ -5,6 +5,11 @@
 #include "Framework/Text/DefaultLayoutBlock.h"
 #include "Framework/Text/RunUtils.h"
 #include "Widgets/NTexture.h"
+#include "FairyCommons.h"
+
+DECLARE_CYCLE_STAT(TEXT("Bitmap Font Measure"), STAT_FairyGUI_BitmapFontMeasure, STATGROUP_FairyGUI);
+DECLARE_CYCLE_STAT(TEXT("Bitmap Font Paint"), STAT_FairyGUI_BitmapFontPaint, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bitmap Font Glyphs"), STAT_FairyGUI_BitmapFontGlyphs, STATGROUP_FairyGUI);
 
 TSharedRef<FBitmapFontRun> FBitmapFontRun::Create(const TSharedRef<const FString>& InText, const TSharedRef<FBitmapFont>& InFont, const FTextRange& InRange)
 {
@@ -15,20 +20,44 @@ FBitmapFontRun::FBitmapFontRun(const TSharedRef<const FString>& InText, const TS
 	: Text(InText)
 	  , Range(InRange)
 	  , Font(InFont)
+	  , MaxLineHeight(0)
 {
-	Glyph = Font->Glyphs.Find(Text.Get()[Range.BeginIndex]);
-	if (Glyph != nullptr)
+	if (Font->Texture != nullptr)
 	{
 		Brush.SetResourceObject(Font->Texture->NativeTexture);
-		Brush.SetImageSize(Glyph->Size);
-		Brush.SetUVRegion(Glyph->UVRect);
+		ResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(Brush);
 	}
+	UpdateGlyphs();
 }
 
 FBitmapFontRun::~FBitmapFontRun()
 {
 }
 
+void FBitmapFontRun::UpdateGlyphs()
+{
+	Glyphs.Reset(Range.Len());
+	MaxLineHeight = 0;
+	for (int32 i = Range.BeginIndex; i < Range.EndIndex; i++)
+	{
+		const FBitmapFont::FGlyph* Glyph = Font->Glyphs.Find(Text.Get()[i]);
+		if (Glyph != nullptr)
+			MaxLineHeight = FMath::Max(MaxLineHeight, Glyph->LineHeight);
+		Glyphs.Add(Glyph);
+	}
+}
+
+float FBitmapFontRun::MeasureWidth(int32 BeginIndex, int32 EndIndex) const
+{
+	float Width = 0;
+	for (int32 i = BeginIndex; i < EndIndex; i++)
+	{
+		if (const FBitmapFont::FGlyph* Glyph = Glyphs[i - Range.BeginIndex])
+			Width += Glyph->XAdvance;
+	}
+	return Width;
+}
+
 const TArray<TSharedRef<SWidget>>& FBitmapFontRun::GetChildren()
 {
 	static TArray<TSharedRef<SWidget>> NoChildren;
@@ -42,9 +71,6 @@ void FBitmapFontRun::ArrangeChildren(const TSharedRef<ILayoutBlock>& Block, cons
 
 int32 FBitmapFontRun::GetTextIndexAt(const TSharedRef<ILayoutBlock>& Block, const FVector2D& Location, float Scale, ETextHitPoint* const OutHitPoint) const
 {
-	// An image should always contain a single character (a breaking space)
-	check(Range.Len() == 1);
-
 	const FVector2D& BlockOffset = Block->GetLocationOffset();
 	const FVector2D& BlockSize = Block->GetSize();
 
@@ -60,15 +86,26 @@ int32 FBitmapFontRun::GetTextIndexAt(const TSharedRef<ILayoutBlock>& Block, cons
 		return INDEX_NONE;
 	}
 
-	const float ScaledImageSize = Glyph->XAdvance * Scale;
-	const int32 Index = (Location.X <= (Left + (ScaledImageSize * 0.5f))) ? Range.BeginIndex : Range.EndIndex;
+	const FTextRange BlockRange = Block->GetTextRange();
+
+	// Walk the glyphs of the block, the nearer edge of the glyph under the point wins
+	int32 Index = BlockRange.EndIndex;
+	float X = Left;
+	for (int32 i = BlockRange.BeginIndex; i < BlockRange.EndIndex; i++)
+	{
+		const FBitmapFont::FGlyph* Glyph = Glyphs[i - Range.BeginIndex];
+		const float Advance = Glyph != nullptr ? Glyph->XAdvance * Scale : 0;
+		if (Location.X < X + Advance)
+		{
+			Index = (Location.X <= X + Advance * 0.5f) ? i : i + 1;
+			break;
+		}
+		X += Advance;
+	}
 
 	if (OutHitPoint)
 	{
-		const FTextRange BlockRange = Block->GetTextRange();
 		const FLayoutBlockTextContext BlockTextContext = Block->GetTextContext();
-
-		// The block for an image will always detect a LTR reading direction, so use the base direction (of the line) for the image hit-point detection
 		*OutHitPoint = RunUtils::CalculateTextHitPoint(Index, BlockRange, BlockTextContext.BaseDirection);
 	}
 
@@ -77,14 +114,18 @@ int32 FBitmapFontRun::GetTextIndexAt(const TSharedRef<ILayoutBlock>& Block, cons
 
 FVector2D FBitmapFontRun::GetLocationAt(const TSharedRef<ILayoutBlock>& Block, int32 Offset, float Scale) const
 {
-	return Block->GetLocationOffset();
+	const FTextRange BlockRange = Block->GetTextRange();
+	const int32 EndIndex = FMath::Clamp(Offset, BlockRange.BeginIndex, BlockRange.EndIndex);
+	return Block->GetLocationOffset() + FVector2D(MeasureWidth(BlockRange.BeginIndex, EndIndex) * Scale, 0);
 }
 
 int32 FBitmapFontRun::OnPaint(const FPaintArgs& PaintArgs, const FTextArgs& TextArgs, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
-	if (Glyph == nullptr)
+	if (!ResourceHandle.IsValid())
 		return LayerId;
 
+	SCOPE_CYCLE_COUNTER(STAT_FairyGUI_BitmapFontPaint);
+
 	// The block size and offset values are pre-scaled, so we need to account for that when converting the block offsets into paint geometry
 	const float InverseScale = Inverse(AllottedGeometry.Scale);
 
@@ -93,15 +134,55 @@ int32 FBitmapFontRun::OnPaint(const FPaintArgs& PaintArgs, const FTextArgs& Text
 		FinalColorAndOpacity = InWidgetStyle.GetColorAndOpacityTint() * TextArgs.DefaultStyle.ColorAndOpacity.GetSpecifiedColor();
 	else
 		FinalColorAndOpacity = InWidgetStyle.GetColorAndOpacityTint();
+	const FColor Color = FinalColorAndOpacity.ToFColor(true);
 	const ESlateDrawEffect DrawEffects = bParentEnabled ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
-	FSlateDrawElement::MakeBox(
-		OutDrawElements,
-		++LayerId,
-		AllottedGeometry.ToPaintGeometry(Glyph->Size, FSlateLayoutTransform(TransformPoint(InverseScale, TextArgs.Block->GetLocationOffset()) + Glyph->Offset)),
-		&Brush,
-		DrawEffects,
-		FinalColorAndOpacity
-	);
+
+	// All glyphs of the block come from the font texture, so they go out as one element
+	Vertices.Reset();
+	Triangles.Reset();
+
+	const FTextRange BlockRange = TextArgs.Block->GetTextRange();
+	FVector2D Pen = TransformPoint(InverseScale, TextArgs.Block->GetLocationOffset());
+	for (int32 i = BlockRange.BeginIndex; i < BlockRange.EndIndex; i++)
+	{
+		const FBitmapFont::FGlyph* Glyph = Glyphs[i - Range.BeginIndex];
+		if (Glyph == nullptr)
+			continue;
+
+		const FVector2D Min = Pen + Glyph->Offset;
+		const FVector2D Max = Min + Glyph->Size;
+		const FVector2D Corners[4] = { FVector2D(Min.X, Max.Y), Min, FVector2D(Max.X, Min.Y), Max };
+		const FVector2D UVs[4] = { FVector2D(Glyph->UVRect.Min.X, Glyph->UVRect.Max.Y), Glyph->UVRect.Min, FVector2D(Glyph->UVRect.Max.X, Glyph->UVRect.Min.Y), Glyph->UVRect.Max };
+
+		const SlateIndex Base = (SlateIndex)Vertices.Num();
+		for (int32 k = 0; k < 4; k++)
+		{
+			FSlateVertex Vertex;
+			Vertex.Position = FVector2f(AllottedGeometry.LocalToAbsolute(Corners[k]));
+			Vertex.Color = Color;
+			Vertex.TexCoords[0] = UVs[k].X;
+			Vertex.TexCoords[1] = UVs[k].Y;
+			Vertex.TexCoords[2] = 1;
+			Vertex.TexCoords[3] = 1;
+			Vertex.MaterialTexCoords[0] = UVs[k].X;
+			Vertex.MaterialTexCoords[1] = UVs[k].Y;
+			Vertices.Add(Vertex);
+		}
+		Triangles.Add(Base);
+		Triangles.Add(Base + 1);
+		Triangles.Add(Base + 2);
+		Triangles.Add(Base + 2);
+		Triangles.Add(Base + 3);
+		Triangles.Add(Base);
+
+		Pen.X += Glyph->XAdvance;
+	}
+
+	if (Vertices.Num() == 0)
+		return LayerId;
+
+	INC_DWORD_STAT_BY(STAT_FairyGUI_BitmapFontGlyphs, Vertices.Num() / 4);
+	FSlateDrawElement::MakeCustomVerts(OutDrawElements, ++LayerId, ResourceHandle, Vertices, Triangles, nullptr, 0, 0, DrawEffects);
 
 	return LayerId;
 }
@@ -118,20 +199,30 @@ int8 FBitmapFontRun::GetKerning(int32 CurrentIndex, float Scale, const FRunTextC
 
 FVector2D FBitmapFontRun::Measure(int32 BeginIndex, int32 EndIndex, float Scale, const FRunTextContext& TextContext) const
 {
-	if (Glyph == nullptr || (EndIndex - BeginIndex == 0))
+	if (EndIndex - BeginIndex == 0)
 	{
 		return FVector2D(0, GetMaxHeight(Scale));
 	}
 
-	return FVector2D(Glyph->XAdvance, Glyph->LineHeight) * Scale;
+	SCOPE_CYCLE_COUNTER(STAT_FairyGUI_BitmapFontMeasure);
+
+	float Width = 0;
+	float Height = 0;
+	for (int32 i = BeginIndex; i < EndIndex; i++)
+	{
+		if (const FBitmapFont::FGlyph* Glyph = Glyphs[i - Range.BeginIndex])
+		{
+			Width += Glyph->XAdvance;
+			Height = FMath::Max(Height, Glyph->LineHeight);
+		}
+	}
+
+	return FVector2D(Width, Height) * Scale;
 }
 
 int16 FBitmapFontRun::GetMaxHeight(float Scale) const
 {
-	if (Glyph == nullptr)
-		return 0;
-	else
-		return Glyph->LineHeight * Scale;
+	return MaxLineHeight * Scale;
 }
 
 int16 FBitmapFontRun::GetBaseLine(float Scale) const
@@ -147,12 +238,14 @@ FTextRange FBitmapFontRun::GetTextRange() const
 void FBitmapFontRun::SetTextRange(const FTextRange& Value)
 {
 	Range = Value;
+	UpdateGlyphs();
 }
 
 void FBitmapFontRun::Move(const TSharedRef<FString>& NewText, const FTextRange& NewRange)
 {
 	Text = NewText;
 	Range = NewRange;
+	UpdateGlyphs();
 }
 
 TSharedRef<IRun> FBitmapFontRun::Clone() const
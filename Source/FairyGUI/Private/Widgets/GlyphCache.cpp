@@ -0,0 +1,76 @@
+#include "Widgets/GlyphCache.h"
+#include "Fonts/FontCache.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+#include "FairyApplication.h"
+#include "UI/UIConfig.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Glyph Cache Misses"), STAT_FairyGUI_GlyphCacheMisses, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Glyphs Prewarmed"), STAT_FairyGUI_GlyphsPrewarmed, STATGROUP_FairyGUI);
+
+TMap<FSlateFontInfo, TSet<TCHAR>> FGlyphCache::RenderedGlyphs;
+
+int32 FGlyphCache::QuantizeFontSize(int32 InSize)
+{
+    int32 Result = MAX_int32;
+    for (int32 Bucket : UFairyApplication::GetUIConfig().FontSizeBuckets)
+    {
+        if (Bucket >= InSize && Bucket < Result)
+            Result = Bucket;
+    }
+
+    return Result != MAX_int32 ? Result : InSize;
+}
+
+void FGlyphCache::Prewarm(const FSlateFontInfo& InFont, FStringView InCharacters, float InScale)
+{
+    if (!FSlateApplication::IsInitialized() || InCharacters.Len() == 0)
+        return;
+
+    TSet<TCHAR>& Glyphs = GetGlyphs(InFont, InScale);
+    FString Missing;
+    for (TCHAR Char : InCharacters)
+    {
+        bool bAlreadyInSet;
+        if (!FChar::IsLinebreak(Char))
+        {
+            Glyphs.Add(Char, &bAlreadyInSet);
+            if (!bAlreadyInSet)
+                Missing.AppendChar(Char);
+        }
+    }
+    if (Missing.IsEmpty())
+        return;
+
+    INC_DWORD_STAT_BY(STAT_FairyGUI_GlyphsPrewarmed, Missing.Len());
+
+    TSharedRef<FSlateFontCache> FontCache = FSlateApplication::Get().GetRenderer()->GetFontCache();
+    FShapedGlyphSequenceRef Sequence = FontCache->ShapeUnidirectionalText(*Missing, 0, Missing.Len(), InFont, InScale, TextBiDi::ETextDirection::LeftToRight, ETextShapingMethod::Auto);
+    for (const FShapedGlyphEntry& Glyph : Sequence->GetGlyphsToRender())
+        FontCache->GetShapedGlyphFontAtlasData(Glyph, InFont.OutlineSettings);
+}
+
+void FGlyphCache::TrackGlyphs(const FSlateFontInfo& InFont, FStringView InText, float InScale)
+{
+    TSet<TCHAR>& Glyphs = GetGlyphs(InFont, InScale);
+    for (TCHAR Char : InText)
+    {
+        bool bAlreadyInSet;
+        Glyphs.Add(Char, &bAlreadyInSet);
+        if (!bAlreadyInSet)
+            INC_DWORD_STAT(STAT_FairyGUI_GlyphCacheMisses);
+    }
+}
+
+void FGlyphCache::Empty()
+{
+    RenderedGlyphs.Empty();
+}
+
+TSet<TCHAR>& FGlyphCache::GetGlyphs(const FSlateFontInfo& InFont, float InScale)
+{
+    //glyphs are rasterized at the font size times the layout scale
+    FSlateFontInfo Key = InFont;
+    Key.Size = InFont.Size * InScale;
+    return RenderedGlyphs.FindOrAdd(Key);
+}
@@ -1,12 +1,19 @@
 #include "Widgets/NGraphics.h"
+#include "FairyCommons.h"
+#include "Widgets/SWidget.h"
+
+DECLARE_CYCLE_STAT(TEXT("Transform Vertices"), STAT_FairyGUI_TransformVertices, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Transformed Vertices"), STAT_FairyGUI_TransformedVertices, STATGROUP_FairyGUI);
 
 FNGraphics::FNGraphics() :
+    Owner(nullptr),
     Size(ForceInit),
     Color(FColor::White),
     Flip(EFlipType::None),
     Texture(nullptr),
     UsingAlpha(1),
-    bMeshDirty(false)
+    bMeshDirty(false),
+    bPositionsDirty(true)
 {
 }
 
@@ -14,12 +21,19 @@ FNGraphics::~FNGraphics()
 {
 }
 
+void FNGraphics::SetMeshDirty()
+{
+    bMeshDirty = true;
+    if (Owner != nullptr)
+        Owner->Invalidate(EInvalidateWidgetReason::Paint);
+}
+
 void FNGraphics::SetColor(const FColor& InColor)
 {
     if (Color != InColor)
     {
-        bMeshDirty = true;
         Color = InColor;
+        SetMeshDirty();
     }
 }
 
@@ -28,14 +42,14 @@ void FNGraphics::SetFlip(EFlipType InFlip)
     if (Flip != InFlip)
     {
         Flip = InFlip;
-        bMeshDirty = true;
+        SetMeshDirty();
     }
 }
 
 void FNGraphics::SetMeshFactory(const TSharedPtr<IMeshFactory>& InMeshFactory)
 {
     MeshFactory = InMeshFactory;
-    bMeshDirty = true;
+    SetMeshDirty();
 }
 
 void FNGraphics::SetTexture(UNTexture* InTexture)
@@ -55,7 +69,7 @@ void FNGraphics::SetTexture(UNTexture* InTexture)
             Brush.SetResourceObject(nullptr);
             ResourceHandle = FSlateResourceHandle();
         }
-        bMeshDirty = true;
+        SetMeshDirty();
     }
 }
 
@@ -88,18 +102,76 @@ void FNGraphics::Paint(const FGeometry& AllottedGeometry,
 
     const ESlateDrawEffect DrawEffects = bEnabled ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect;
 
-    int32 VerticeLength = Vertices.Num();
-    for (int32 i = 0; i < VerticeLength; i++)
-    {
-        Vertices[i].Position = AllottedGeometry.LocalToAbsolute(PositionsBackup[i]);
-    }
+    const FSlateRenderTransform& Transform = AllottedGeometry.GetAccumulatedRenderTransform();
+    if (bPositionsDirty || Transform.GetMatrix() != PaintTransform.GetMatrix())
+        UpdatePositions(Transform, true);
+    else if (Transform.GetTranslation() != PaintTransform.GetTranslation())
+        UpdatePositions(Transform, false);
 
     FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, ResourceHandle, Vertices, Triangles, nullptr, 0, 0, DrawEffects);
 }
 
+void FNGraphics::UpdatePositions(const FSlateRenderTransform& Transform, bool bMatrixChanged)
+{
+    SCOPE_CYCLE_COUNTER(STAT_FairyGUI_TransformVertices);
+
+    PaintTransform = Transform;
+    bPositionsDirty = false;
+
+    int32 cnt = Vertices.Num();
+    INC_DWORD_STAT_BY(STAT_FairyGUI_TransformedVertices, cnt);
+    if (cnt == 0)
+        return;
+
+    //two vertices per register, (x0, y0, x1, y1)
+    const FVector2f Translation = Transform.GetTranslation();
+    const VectorRegister4Float Offset = MakeVectorRegisterFloat(Translation.X, Translation.Y, Translation.X, Translation.Y);
+    alignas(16) float Out[4];
+    int32 i = 0;
+
+    if (bMatrixChanged)
+    {
+        float A, B, C, D;
+        Transform.GetMatrix().GetMatrix(A, B, C, D);
+        const VectorRegister4Float XCoef = MakeVectorRegisterFloat(A, B, A, B);
+        const VectorRegister4Float YCoef = MakeVectorRegisterFloat(C, D, C, D);
+
+        LinearPositions.SetNumUninitialized(cnt, EAllowShrinking::No);
+        const float* Src = (const float*)PositionsBackup.GetData();
+        float* Dst = (float*)LinearPositions.GetData();
+        for (; i + 1 < cnt; i += 2)
+        {
+            VectorRegister4Float P = VectorLoad(Src + i * 2);
+            VectorRegister4Float L = VectorMultiplyAdd(VectorSwizzle(P, 0, 0, 2, 2), XCoef, VectorMultiply(VectorSwizzle(P, 1, 1, 3, 3), YCoef));
+            VectorStore(L, Dst + i * 2);
+            VectorStoreAligned(VectorAdd(L, Offset), Out);
+            Vertices[i].Position = FVector2f(Out[0], Out[1]);
+            Vertices[i + 1].Position = FVector2f(Out[2], Out[3]);
+        }
+        if (i < cnt)
+        {
+            LinearPositions[i] = Transform.GetMatrix().TransformPoint(PositionsBackup[i]);
+            Vertices[i].Position = LinearPositions[i] + Translation;
+        }
+    }
+    else
+    {
+        const float* Src = (const float*)LinearPositions.GetData();
+        for (; i + 1 < cnt; i += 2)
+        {
+            VectorStoreAligned(VectorAdd(VectorLoad(Src + i * 2), Offset), Out);
+            Vertices[i].Position = FVector2f(Out[0], Out[1]);
+            Vertices[i + 1].Position = FVector2f(Out[2], Out[3]);
+        }
+        if (i < cnt)
+            Vertices[i].Position = LinearPositions[i] + Translation;
+    }
+}
+
 void FNGraphics::UpdateMeshNow()
 {
     bMeshDirty = false;
+    bPositionsDirty = true;
     Vertices.Reset();
     Triangles.Reset();
 
@@ -157,7 +229,7 @@ void FNGraphics::UpdateMeshNow()
         AlphaBackup[i] = Vertex.Color.A;
         Vertex.Color.A = (uint8)FMath::Clamp<int32>(FMath::TruncToInt(Vertex.Color.A * UsingAlpha), 0, 255),
 
-        PositionsBackup[i] = FVector2D(Vertex.Position);
+        PositionsBackup[i] = FVector2f(Vertex.Position);
     }
 
     Vertices += Helper.Vertices;
@@ -29,6 +29,31 @@ bool FNTextFormat::EqualStyle(const FNTextFormat& AnotherFormat) const
         && Align == AnotherFormat.Align;
 }
 
+bool FNTextFormat::operator==(const FNTextFormat& AnotherFormat) const
+{
+    return EqualStyle(AnotherFormat) && Face == AnotherFormat.Face
+        && LineSpacing == AnotherFormat.LineSpacing && LetterSpacing == AnotherFormat.LetterSpacing
+        && VerticalAlign == AnotherFormat.VerticalAlign
+        && OutlineColor == AnotherFormat.OutlineColor && OutlineSize == AnotherFormat.OutlineSize
+        && ShadowColor == AnotherFormat.ShadowColor && ShadowOffset == AnotherFormat.ShadowOffset;
+}
+
+uint32 GetTypeHash(const FNTextFormat& Format)
+{
+    uint32 Hash = GetTypeHash(Format.Face);
+    Hash = HashCombine(Hash, GetTypeHash(Format.Size));
+    Hash = HashCombine(Hash, GetTypeHash(Format.Color));
+    Hash = HashCombine(Hash, (uint32)Format.bBold | ((uint32)Format.bItalic << 1) | ((uint32)Format.bUnderline << 2));
+    Hash = HashCombine(Hash, GetTypeHash(Format.LineSpacing));
+    Hash = HashCombine(Hash, GetTypeHash(Format.LetterSpacing));
+    Hash = HashCombine(Hash, (uint32)Format.Align | ((uint32)Format.VerticalAlign << 8));
+    Hash = HashCombine(Hash, GetTypeHash(Format.OutlineColor));
+    Hash = HashCombine(Hash, GetTypeHash(Format.OutlineSize));
+    Hash = HashCombine(Hash, GetTypeHash(Format.ShadowColor));
+    Hash = HashCombine(Hash, GetTypeHash(Format.ShadowOffset));
+    return Hash;
+}
+
 FTextBlockStyle FNTextFormat::GetStyle() const
 {
     FTextBlockStyle Style;
@@ -2,9 +2,22 @@
 #include "Widgets/SContainer.h"
 #include "FairyApplication.h"
 #include "UI/GObject.h"
+#include "Widgets/NGraphics.h"
+#include "Algo/BinarySearch.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Paint Layers"), STAT_FairyGUI_PaintLayers, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Paint Layers (Unbatched)"), STAT_FairyGUI_PaintLayersUnbatched, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Culled Children"), STAT_FairyGUI_CulledChildren, STATGROUP_FairyGUI);
+
+//beyond this many painted siblings the overlap test stops paying off, later children go above all of them
+static const int32 MaxBatchCandidates = 64;
+//containers with at least this many children look up the children in view instead of testing each of them
+static const int32 CullingIndexThreshold = 32;
 
 SContainer::SContainer() :
-    Children(this)
+    Children(this),
+    bLayerBatching(false),
+    bChildBoundsDirty(true)
 {
     bCanSupportFocus = false;
 }
@@ -34,6 +47,9 @@ void SContainer::AddChildAt(const TSharedRef<SWidget>& SlotWidget, int32 Index)
             Children.Add(SlotWidget);
         else
             Children.Insert(SlotWidget, Index);
+        OnChildPaintBoundsChanged();
+        Invalidate(EInvalidateWidgetReason::ChildOrder);
+        ++HierarchyRevision;
 
         UGObject* OnStageObj = SDisplayObject::GetWidgetGObjectIfOnStage(AsShared());
         if (OnStageObj != nullptr)
@@ -51,6 +67,8 @@ void SContainer::SetChildIndex(const TSharedRef<SWidget>& SlotWidget, int32 Inde
     verifyf(OldIndex != -1, TEXT("Not a child of this container"));
     if (OldIndex == Index) return;
     Children.Swap(OldIndex, Index);
+    OnChildPaintBoundsChanged();
+    Invalidate(EInvalidateWidgetReason::ChildOrder);
 }
 
 void SContainer::RemoveChild(const TSharedRef<SWidget>& SlotWidget)
@@ -71,6 +89,9 @@ void SContainer::RemoveChildAt(int32 Index)
     }
 
     Children.RemoveAt(Index);
+    OnChildPaintBoundsChanged();
+    Invalidate(EInvalidateWidgetReason::ChildOrder);
+    ++HierarchyRevision;
 }
 
 int32 SContainer::GetChildIndex(const TSharedRef<SWidget>& SlotWidget) const
@@ -108,6 +129,18 @@ void SContainer::RemoveChildren(int32 BeginIndex, int32 EndIndex)
     }
     else
         Children.Empty();
+    OnChildPaintBoundsChanged();
+    Invalidate(EInvalidateWidgetReason::ChildOrder);
+    ++HierarchyRevision;
+}
+
+void SContainer::SetLayerBatching(bool bInLayerBatching)
+{
+    if (bLayerBatching != bInLayerBatching)
+    {
+        bLayerBatching = bInLayerBatching;
+        Invalidate(EInvalidateWidgetReason::Paint);
+    }
 }
 
 int32 SContainer::NumChildren() const
@@ -136,7 +169,10 @@ void SContainer::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedC
 int32 SContainer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
     FArrangedChildren ArrangedChildren(EVisibility::Visible);
-    ArrangeChildren(AllottedGeometry, ArrangedChildren);
+    if (Children.Num() >= CullingIndexThreshold)
+        ArrangeVisibleChildren(AllottedGeometry, MyCullingRect, ArrangedChildren);
+    else
+        ArrangeChildren(AllottedGeometry, ArrangedChildren);
 
     // Because we paint multiple children, we must track the maximum layer id that they produced in case one of our parents
     // wants to an overlay for all of its contents.
@@ -146,25 +182,196 @@ int32 SContainer::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeome
 
     const FPaintArgs NewArgs = Args.WithNewParent(this);
 
+    // In batching mode a child is painted on the lowest layer that keeps it above every earlier sibling it overlaps,
+    // so siblings that don't overlap end up on the same layer and Slate can batch their draws by texture.
+    // A child drawing with the same resource as an overlapped sibling may join that sibling's layer,
+    // elements of one batch are drawn in the order they were added.
+    struct FPaintedChild
+    {
+        FSlateRect Bounds;
+        int32 LayerId;
+        int32 MaxLayerId;
+        const FSlateShaderResourceProxy* Resource;
+        bool bEnabled;
+    };
+    TArray<FPaintedChild, TInlineAllocator<16>> PaintedChildren;
+    const bool bBatching = bLayerBatching || UFairyApplication::UIConfig.LayerBatching;
+    int32 FloorLayerId = LayerId + 1;
+
     for (int32 ChildIndex = 0; ChildIndex < ArrangedChildren.Num(); ++ChildIndex)
     {
         FArrangedWidget& CurWidget = ArrangedChildren[ChildIndex];
+        const bool bDisplayObject = CurWidget.Widget->GetTag() == SDisplayObject::SDisplayObjectTag;
+        const SDisplayObject* DisplayObject = bDisplayObject ? static_cast<const SDisplayObject*>(&CurWidget.Widget.Get()) : nullptr;
 
-        //if (!IsChildWidgetCulled(MyCullingRect, CurWidget))
+        FSlateRect ChildBounds;
+        if (DisplayObject != nullptr)
         {
-            const int32 CurWidgetsMaxLayerId = CurWidget.Widget->Paint(NewArgs, CurWidget.Geometry, MyCullingRect, OutDrawElements, MaxLayerId + 1, InWidgetStyle, bForwardedEnabled);
-
-            MaxLayerId = FMath::Max(MaxLayerId, CurWidgetsMaxLayerId);
+            ChildBounds = DisplayObject->GetPaintBounds(CurWidget.Geometry);
+            if (!FSlateRect::DoRectanglesIntersect(ChildBounds, MyCullingRect))
+            {
+                INC_DWORD_STAT(STAT_FairyGUI_CulledChildren);
+                continue;
+            }
         }
-        //else
+
+        int32 ChildLayerId = MaxLayerId + 1;
+        const FSlateShaderResourceProxy* Resource = nullptr;
+        const bool bEnabled = CurWidget.Widget->IsEnabled();
+        if (bBatching && DisplayObject != nullptr)
         {
+            const FNGraphics* Graphics = DisplayObject->GetGraphics();
+            if (Graphics != nullptr && Graphics->GetResourceHandle().IsValid())
+                Resource = Graphics->GetResourceHandle().GetResourceProxy();
+
+            ChildLayerId = FloorLayerId;
+            for (const FPaintedChild& Other : PaintedChildren)
+            {
+                if (Other.MaxLayerId < ChildLayerId || !FSlateRect::DoRectanglesIntersect(ChildBounds, Other.Bounds))
+                    continue;
 
+                if (Resource != nullptr && Resource == Other.Resource && bEnabled == Other.bEnabled)
+                    ChildLayerId = FMath::Max(ChildLayerId, Other.LayerId);
+                else
+                    ChildLayerId = Other.MaxLayerId + 1;
+            }
+        }
+
+        const int32 CurWidgetsMaxLayerId = CurWidget.Widget->Paint(NewArgs, CurWidget.Geometry, MyCullingRect, OutDrawElements, ChildLayerId, InWidgetStyle, bForwardedEnabled);
+
+        INC_DWORD_STAT(STAT_FairyGUI_PaintLayersUnbatched);
+        if (ChildLayerId > MaxLayerId)
+            INC_DWORD_STAT(STAT_FairyGUI_PaintLayers);
+
+        MaxLayerId = FMath::Max(MaxLayerId, CurWidgetsMaxLayerId);
+
+        if (bBatching)
+        {
+            if (DisplayObject == nullptr || PaintedChildren.Num() >= MaxBatchCandidates)
+            {
+                PaintedChildren.Reset();
+                FloorLayerId = MaxLayerId + 1;
+            }
+            else
+                PaintedChildren.Add({ ChildBounds, ChildLayerId, FMath::Max(ChildLayerId, CurWidgetsMaxLayerId), Resource, bEnabled });
         }
     }
 
     return MaxLayerId;
 }
 
+void SContainer::ArrangeVisibleChildren(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FArrangedChildren& ArrangedChildren) const
+{
+    UpdateChildBounds();
+
+    const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+    if (FMath::IsNearlyZero(RenderTransform.GetMatrix().Determinant()))
+        return;
+
+    //bring the culling rect into our space, with rotation or skew its bounding box is tested
+    const FSlateRect LocalCullingRect = TransformRect(Inverse(RenderTransform), FSlateRotatedRect(MyCullingRect)).ToBoundingRect();
+
+    //the first entry whose bottom edge, or the bottom edge of any entry before it, goes below the top of the view
+    int32 First = Algo::UpperBound(ChildBoundsMaxBottom, LocalCullingRect.Top);
+
+    TArray<int32, TInlineAllocator<64>> Indice;
+    for (int32 i = First; i < ChildBounds.Num() && ChildBounds[i].Rect.Top <= LocalCullingRect.Bottom; i++)
+    {
+        if (FSlateRect::DoRectanglesIntersect(ChildBounds[i].Rect, LocalCullingRect))
+            Indice.Add(ChildBounds[i].Index);
+    }
+    Indice.Sort();
+    INC_DWORD_STAT_BY(STAT_FairyGUI_CulledChildren, Children.Num() - Indice.Num());
+
+    SDisplayObject::bMindVisibleOnly = true;
+
+    for (int32 ChildIndex : Indice)
+    {
+        if (const TSharedRef<SWidget>& CurWidget = Children[ChildIndex]; ArrangedChildren.Accepts(CurWidget->GetVisibility()))
+            ArrangedChildren.AddWidget(AllottedGeometry.MakeChild(
+                CurWidget, FVector2D::ZeroVector, CurWidget.Get().GetDesiredSize()
+            ));
+    }
+
+    SDisplayObject::bMindVisibleOnly = false;
+}
+
+FSlateRect SContainer::GetLocalPaintBounds() const
+{
+    FSlateRect Rect = SDisplayObject::GetLocalPaintBounds();
+    //children of an unclipped container may draw outside of it
+    if (GetClipping() == EWidgetClipping::Inherit)
+    {
+        UpdateChildBounds();
+        if (ContentBounds.IsValid())
+            Rect = Rect.Expand(ContentBounds);
+    }
+    return Rect;
+}
+
+void SContainer::OnChildPaintBoundsChanged()
+{
+    //culling and layer batching are decided while painting the container, redo them when a child moves
+    if (Children.Num() >= CullingIndexThreshold || bLayerBatching || UFairyApplication::UIConfig.LayerBatching)
+        Invalidate(EInvalidateWidgetReason::Paint);
+
+    //a dirty container has already told its parents
+    if (bChildBoundsDirty)
+        return;
+
+    bChildBoundsDirty = true;
+    InvalidatePaintBounds();
+}
+
+void SContainer::UpdateChildBounds() const
+{
+    if (!bChildBoundsDirty)
+        return;
+
+    bChildBoundsDirty = false;
+    ChildBounds.Reset();
+    ChildBoundsMaxBottom.Reset();
+    ContentBounds = FSlateRect();
+
+    for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+    {
+        FSlateRect Rect = GetChildLocalBounds(Children[ChildIndex]);
+        ContentBounds = ContentBounds.IsValid() ? ContentBounds.Expand(Rect) : Rect;
+        ChildBounds.Add({ Rect, ChildIndex });
+    }
+
+    if (Children.Num() >= CullingIndexThreshold)
+    {
+        ChildBounds.Sort([](const FChildBounds& A, const FChildBounds& B) { return A.Rect.Top < B.Rect.Top; });
+
+        ChildBoundsMaxBottom.SetNumUninitialized(ChildBounds.Num());
+        float MaxBottom = -FLT_MAX;
+        for (int32 i = 0; i < ChildBounds.Num(); i++)
+        {
+            MaxBottom = FMath::Max(MaxBottom, ChildBounds[i].Rect.Bottom);
+            ChildBoundsMaxBottom[i] = MaxBottom;
+        }
+    }
+}
+
+FSlateRect SContainer::GetChildLocalBounds(const TSharedRef<SWidget>& Child) const
+{
+    //widgets that are not ours may draw anywhere
+    if (Child->GetTag() != SDisplayObject::SDisplayObjectTag)
+        return FSlateRect(-1e7f, -1e7f, 1e7f, 1e7f);
+
+    const SDisplayObject& DisplayObject = static_cast<const SDisplayObject&>(Child.Get());
+    FSlateRect Rect = DisplayObject.GetLocalPaintBounds();
+    const TOptional<FSlateRenderTransform>& RenderTransform = Child->GetRenderTransformWithRespectToFlowDirection();
+    if (!RenderTransform.IsSet())
+        return Rect;
+
+    //the same transform FGeometry::MakeChild builds, the pivot is relative to the arranged size
+    const FVector2f Pivot = FVector2f(Child->GetRenderTransformPivotWithRespectToFlowDirection()) * FVector2f(DisplayObject.GetSize());
+    const FSlateRenderTransform ChildTransform = TransformCast<FSlateRenderTransform>(Concatenate(Inverse(Pivot), RenderTransform.GetValue(), Pivot));
+    return TransformRect(ChildTransform, FSlateRotatedRect(Rect)).ToBoundingRect();
+}
+
 FChildren* SContainer::GetChildren()
 {
     return &Children;
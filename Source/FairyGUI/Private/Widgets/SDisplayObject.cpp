@@ -4,6 +4,7 @@
 #include "UI/GObject.h"
 
 bool SDisplayObject::bMindVisibleOnly = false;
+uint32 SDisplayObject::HierarchyRevision = 0;
 FNoChildren SDisplayObject::NoChildrenInstance = FNoChildren::NoChildrenInstance;
 FName SDisplayObject::SDisplayObjectTag("SDisplayObjectTag");
 
@@ -39,6 +40,7 @@ void SDisplayObject::SetPosition(const FVector2D& InPosition)
 	else
 		SetRenderTransform(
 			FSlateRenderTransform(GetRenderTransform()->GetMatrix(), InPosition));
+	InvalidatePaintBounds();
 }
 
 void SDisplayObject::SetX(float InX)
@@ -49,6 +51,7 @@ void SDisplayObject::SetX(float InX)
 		SetRenderTransform(
 			FSlateRenderTransform(GetRenderTransform()->GetMatrix(),
 			                      FVector2D(InX, GetRenderTransform()->GetTranslation().Y)));
+	InvalidatePaintBounds();
 }
 
 void SDisplayObject::SetY(float InY)
@@ -59,6 +62,7 @@ void SDisplayObject::SetY(float InY)
 		SetRenderTransform(
 			FSlateRenderTransform(GetRenderTransform()->GetMatrix(),
 			                      FVector2D(GetRenderTransform()->GetTranslation().X, InY)));
+	InvalidatePaintBounds();
 }
 
 void SDisplayObject::SetSize(const FVector2D& InSize)
@@ -66,10 +70,23 @@ void SDisplayObject::SetSize(const FVector2D& InSize)
 	if (Size != InSize)
 	{
 		Size = InSize;
-		Invalidate(EInvalidateWidget::LayoutAndVolatility);
+		Invalidate(EInvalidateWidgetReason::Layout);
+		InvalidatePaintBounds();
 	}
 }
 
+FSlateRect SDisplayObject::GetPaintBounds(const FGeometry& AllottedGeometry) const
+{
+	return TransformRect(AllottedGeometry.GetAccumulatedRenderTransform(), FSlateRotatedRect(GetLocalPaintBounds())).ToBoundingRect();
+}
+
+void SDisplayObject::InvalidatePaintBounds()
+{
+	TSharedPtr<SWidget> ParentWidget = GetParentWidget();
+	if (ParentWidget.IsValid() && ParentWidget->GetTag() == SDisplayObject::SDisplayObjectTag)
+		StaticCastSharedPtr<SDisplayObject>(ParentWidget)->OnChildPaintBoundsChanged();
+}
+
 void SDisplayObject::SetVisible(bool bInVisible)
 {
 	if (bVisible != bInVisible)
@@ -9,6 +9,7 @@ SFImage::SFImage() :
     TileGridIndice(0)
 {
     Graphics.SetMeshFactory(MakeShared<FMeshFactory>(this));
+    Graphics.SetOwner(this);
 }
 
 void SFImage::Construct(const FArguments& InArgs)
@@ -21,10 +22,7 @@ void SFImage::SetTexture(UNTexture* InTexture)
     Graphics.SetTexture(InTexture);
 
     if (InTexture != nullptr && Size.IsZero())
-    {
         SetSize(InTexture->GetSize());
-        Invalidate(EInvalidateWidget::LayoutAndVolatility);
-    }
 }
 
 void SFImage::SetNativeSize()
@@ -36,6 +34,7 @@ void SFImage::SetNativeSize()
 void SFImage::SetScale9Grid(const TOptional<FBox2D>& InGridRect)
 {
     Scale9Grid = InGridRect;
+    Graphics.SetMeshDirty();
 }
 
 void SFImage::SetScaleByTile(bool bInScaleByTile)
@@ -4,6 +4,7 @@
 
 SShape::SShape()
 {
+    Graphics.SetOwner(this);
 }
 
 void SShape::Construct(const FArguments& InArgs)
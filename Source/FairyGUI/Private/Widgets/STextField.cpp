@@ -1,19 +1,60 @@
 #include "Widgets/STextField.h"
 #include "Internationalization/BreakIterator.h"
 #include "Utils/HTMLParser.h"
+#include "Utils/UBBParser.h"
 #include "Widgets/LoaderRun.h"
 #include "Widgets/BitmapFontRun.h"
+#include "Widgets/GlyphCache.h"
 #include "UI/GObject.h"
 #include "UI/UIPackage.h"
+#include "FairyApplication.h"
+#include "UI/UIConfig.h"
+
+//the layout of a quantized font is in rendered units and scaled down when drawn
+static FTextBlockStyle GetLayoutStyle(const FNTextFormat& Format, float FontScale)
+{
+    FTextBlockStyle Style = Format.GetStyle();
+    if (FontScale != 1)
+    {
+        Style.Font.Size /= FontScale;
+        Style.Font.OutlineSettings.OutlineSize = FMath::RoundToInt(Style.Font.OutlineSettings.OutlineSize / FontScale);
+        Style.SetShadowOffset(Style.ShadowOffset / FontScale);
+    }
+    return Style;
+}
 
 STextField::STextField() :
     bHTML(false),
+    bUBB(false),
     AutoSize(EAutoSizeType::None),
     bSingleLine(false),
     MaxWidth(0),
-    TextLayout(FSlateTextLayout::Create(this, FTextBlockStyle::GetDefault()))
+    TextLayout(CreateTextLayout()),
+    bLayoutDirty(true),
+    FontScale(1)
+{
+}
+
+TSharedRef<FSlateTextLayout> STextField::CreateTextLayout()
+{
+    TSharedRef<FSlateTextLayout> Layout = FSlateTextLayout::Create(this, FTextBlockStyle::GetDefault());
+    Layout->SetLineBreakIterator(FBreakIterator::CreateCharacterBoundaryIterator());
+    return Layout;
+}
+
+bool STextField::OwnsTextLayout() const
 {
-    TextLayout->SetLineBreakIterator(FBreakIterator::CreateCharacterBoundaryIterator());
+    //layouts taken from the cache may have been created by another field
+    return &TextLayout->GetChildren()->GetOwner() == this;
+}
+
+FGeometry STextField::GetTextGeometry(const FGeometry& AllottedGeometry) const
+{
+    if (FontScale == 1)
+        return AllottedGeometry;
+
+    //a render transform scales the drawn glyphs without rasterizing them at the new size
+    return AllottedGeometry.MakeChild(Size / FontScale, FSlateLayoutTransform(), FSlateRenderTransform(FontScale), FVector2D::ZeroVector);
 }
 
 void STextField::Construct(const FArguments& InArgs)
@@ -21,13 +62,11 @@ void STextField::Construct(const FArguments& InArgs)
     SDisplayObject::Construct(SDisplayObject::FArguments().GObject(InArgs._GObject));
 }
 
-void STextField::SetText(const FString& InText, bool bInHTML)
+void STextField::SetText(const FString& InText, bool bInHTML, bool bInUBB)
 {
-    const int32 OldLength = Text.Len();
-
-    // Only compare reasonably sized strings, it's not worth checking this
-    // for large blocks of text.
-    if (bHTML == bInHTML && OldLength <= 20)
+    // Texts of another length always differ, and comparing one of the same length
+    // is much cheaper than laying it out again.
+    if (bHTML == bInHTML && bUBB == bInUBB && Text.Len() == InText.Len())
     {
         if (InText.Compare(Text, ESearchCase::CaseSensitive) == 0)
         {
@@ -37,8 +76,43 @@ void STextField::SetText(const FString& InText, bool bInHTML)
 
     Text = InText;
     bHTML = bInHTML;
-    TextLayout->DirtyLayout();
-    Invalidate(EInvalidateWidget::LayoutAndVolatility);
+    bUBB = bInUBB;
+    bLayoutDirty = true;
+    Invalidate(EInvalidateWidgetReason::Layout);
+}
+
+void STextField::AppendLine(const FString& InLine, bool bInHTML, bool bInUBB)
+{
+    //the first line, a change of markup or a pending update lays out the whole text anyway
+    if (Text.IsEmpty() || bHTML != bInHTML || bUBB != bInUBB
+        || bLayoutDirty || TextLayout->IsLayoutDirty() || !OwnsTextLayout())
+    {
+        SetText(Text.IsEmpty() ? InLine : Text + TEXT("\n") + InLine, bInHTML, bInUBB);
+        return;
+    }
+
+    Text.AppendChar('\n');
+    Text.Append(InLine);
+    //the layout no longer matches its cache key
+    LayoutKey.Reset();
+
+    const int32 FirstElement = HTMLElements.Num();
+    const int32 OldChildCount = TextLayout->GetChildren()->Num();
+    ParseText(InLine);
+    if (FontScale != 1 && !CanScaleElements(FirstElement))
+    {
+        bLayoutDirty = true;
+        Invalidate(EInvalidateWidgetReason::Layout);
+        return;
+    }
+    BuildLines(FirstElement);
+
+    TextLayout->UpdateIfNeeded();
+    if (TextLayout->GetChildren()->Num() != OldChildCount)
+        ++HierarchyRevision;
+
+    OnTextLayoutUpdated();
+    Invalidate(EInvalidateWidgetReason::Layout);
 }
 
 void STextField::SetAutoSize(EAutoSizeType InAutoSize)
@@ -46,14 +120,8 @@ void STextField::SetAutoSize(EAutoSizeType InAutoSize)
     if (AutoSize != InAutoSize)
     {
         AutoSize = InAutoSize;
-        if (AutoSize == EAutoSizeType::Both)
-        {
-            TextLayout->SetWrappingWidth(0);
-        }
-        else
-        {
-            TextLayout->SetWrappingWidth(Size.X);
-        }
+        bLayoutDirty = true;
+        Invalidate(EInvalidateWidgetReason::Layout);
     }
 }
 
@@ -62,7 +130,8 @@ void STextField::SetSingleLine(bool bInSingleLine)
     if (bSingleLine != bInSingleLine)
     {
         bSingleLine = bInSingleLine;
-        TextLayout->DirtyLayout();
+        bLayoutDirty = true;
+        Invalidate(EInvalidateWidgetReason::Layout);
     }
 }
 
@@ -71,29 +140,31 @@ void STextField::SetMaxWidth(float InMaxWidth)
     if (MaxWidth != InMaxWidth)
     {
         MaxWidth = InMaxWidth;
-        TextLayout->DirtyLayout();
+        bLayoutDirty = true;
+        Invalidate(EInvalidateWidgetReason::Layout);
     }
 }
 
 FVector2D STextField::GetTextSize()
 {
-    if(TextLayout->IsLayoutDirty())
+    if (bLayoutDirty || TextLayout->IsLayoutDirty())
         UpdateTextLayout();
 
-    return TextLayout->GetSize();
+    return TextLayout->GetSize() * FontScale;
 }
 
 void STextField::SetTextFormat(const FNTextFormat& InFormat)
 {
     if (&InFormat != &TextFormat)
         TextFormat = InFormat;
-    TextLayout->DirtyLayout();
+    bLayoutDirty = true;
+    Invalidate(EInvalidateWidgetReason::Layout);
 }
 
 FVector2D STextField::ComputeDesiredSize(float LayoutScaleMultiplier) const
 {
     TextLayout->SetScale(LayoutScaleMultiplier);
-    if (TextLayout->IsLayoutDirty())
+    if (bLayoutDirty || TextLayout->IsLayoutDirty())
         const_cast<STextField*>(this)->UpdateTextLayout();
 
     return Size;
@@ -101,20 +172,25 @@ FVector2D STextField::ComputeDesiredSize(float LayoutScaleMultiplier) const
 
 FChildren* STextField::GetChildren()
 {
+    //shared layouts never host widgets
+    if (!OwnsTextLayout())
+        return &FNoChildren::NoChildrenInstance;
+
     return TextLayout->GetChildren();
 }
 
 void STextField::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
 {
-    TextLayout->ArrangeChildren(AllottedGeometry, ArrangedChildren);
+    TextLayout->ArrangeChildren(GetTextGeometry(AllottedGeometry), ArrangedChildren);
 }
 
 int32 STextField::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
+    const FVector2D TextSize = TextLayout->GetSize() * FontScale;
     FVector2D AutoScrollValue = FVector2D::ZeroVector; // Scroll to the left
     if (TextFormat.Align != EAlignType::Left)
     {
-        const float ActualWidth = TextLayout->GetSize().X;
+        const float ActualWidth = TextSize.X;
         const float VisibleWidth = Size.X;
         if (VisibleWidth < ActualWidth)
         {
@@ -136,7 +212,7 @@ int32 STextField::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeome
 
     if (TextFormat.VerticalAlign != EVerticalAlignType::Top)
     {
-        const float ActualHeight = TextLayout->GetSize().Y;
+        const float ActualHeight = TextSize.Y;
         const float VisibleHeight = Size.Y;
         switch (TextFormat.VerticalAlign)
         {
@@ -153,59 +229,150 @@ int32 STextField::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeome
             AutoScrollValue.Y = 0;
     }
 
-    TextLayout->SetVisibleRegion(Size, AutoScrollValue * TextLayout->GetScale());
+    TextLayout->SetVisibleRegion(Size / FontScale, AutoScrollValue / FontScale * TextLayout->GetScale());
     TextLayout->UpdateIfNeeded();
 
-    LayerId = TextLayout->OnPaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, ShouldBeEnabled(bParentEnabled));
+    LayerId = TextLayout->OnPaint(Args, GetTextGeometry(AllottedGeometry), MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, ShouldBeEnabled(bParentEnabled));
 
     return LayerId;
 }
 
 void STextField::UpdateTextLayout()
 {
-    TextLayout->ClearLines();
-    TextLayout->ClearLineHighlights();
-    TextLayout->ClearRunRenderers();
+    bLayoutDirty = false;
 
-    TextLayout->SetDefaultTextStyle(TextFormat.GetStyle());
-    TextLayout->SetJustification((ETextJustify::Type)TextFormat.Align);
-    TextLayout->SetWrappingPolicy(ETextWrappingPolicy::AllowPerCharacterWrapping);
-    if (AutoSize == EAutoSizeType::Both)
-        TextLayout->SetWrappingWidth(MaxWidth);
-    else
-        TextLayout->SetWrappingWidth(MaxWidth != 0 ? FMath::Min(MaxWidth, Size.X) : Size.X);
-    TextLayout->SetMargin(FMargin(2, 2));
-    TextLayout->SetLineHeightPercentage(1 + (TextFormat.LineSpacing - 3) / TextFormat.Size);
+    FontScale = 1;
+    if (!TextFormat.Face.StartsWith("ui://") && TextFormat.Size > 0)
+        FontScale = (float)TextFormat.Size / FGlyphCache::QuantizeFontSize(TextFormat.Size);
 
-    HTMLElements.Reset();
-    if (bHTML)
+    const float WrappingWidth = AutoSize == EAutoSizeType::Both ? MaxWidth : (MaxWidth != 0 ? FMath::Min(MaxWidth, Size.X) : Size.X);
+    FTextLayoutKey Key(Text, TextFormat, WrappingWidth, TextLayout->GetScale(), AutoSize, bHTML, bUBB, bSingleLine);
+    FTextLayoutCache& Cache = FTextLayoutCache::Get();
+    const bool bCacheEnabled = UFairyApplication::GetUIConfig().TextLayoutCacheSize > 0;
+    const bool bHadChildren = OwnsTextLayout() && TextLayout->GetChildren()->Num() > 0;
+
+    bool bLayoutReturned = false;
+    if (LayoutKey.IsSet())
     {
-        FHTMLParser::DefaultParser.Parse(Text, TextFormat, HTMLElements, FHTMLParser::DefaultParseOptions);
+        //the old layout is still intact, other fields showing that text can take it over
+        if (!TextLayout->IsLayoutDirty())
+        {
+            Cache.Return(LayoutKey.GetValue(), TextLayout);
+            bLayoutReturned = true;
+        }
+        LayoutKey.Reset();
+    }
+
+    TSharedPtr<FSlateTextLayout> CachedLayout = bCacheEnabled ? Cache.Checkout(Key) : nullptr;
+    if (CachedLayout.IsValid())
+    {
+        TextLayout = CachedLayout.ToSharedRef();
+        LayoutKey = MoveTemp(Key);
+        HTMLElements.Reset();
     }
     else
     {
-        FHTMLElement TextElement;
-        TextElement.Type = EHTMLElementType::Text;
-        TextElement.Format = TextFormat;
-        TextElement.Text = Text;
-        HTMLElements.Add(MoveTemp(TextElement));
+        if (bLayoutReturned || !OwnsTextLayout())
+        {
+            TextLayout = CreateTextLayout();
+            TextLayout->SetScale(Key.Scale);
+        }
+
+        TextLayout->ClearLines();
+        TextLayout->ClearLineHighlights();
+        TextLayout->ClearRunRenderers();
+
+        HTMLElements.Reset();
+        ParseText(Text);
+
+        //the scale applies to the whole layout, images and runs of another size or a bitmap font would be drawn scaled too
+        const float QuantizedScale = FontScale;
+        if (FontScale != 1 && !CanScaleElements(0))
+            FontScale = 1;
+
+        TextLayout->SetDefaultTextStyle(GetLayoutStyle(TextFormat, FontScale));
+        TextLayout->SetJustification((ETextJustify::Type)TextFormat.Align);
+        TextLayout->SetWrappingPolicy(ETextWrappingPolicy::AllowPerCharacterWrapping);
+        TextLayout->SetWrappingWidth(WrappingWidth / FontScale);
+        TextLayout->SetMargin(FMargin(2 / FontScale, 2 / FontScale));
+        TextLayout->SetLineHeightPercentage(1 + (TextFormat.LineSpacing - 3) / TextFormat.Size);
+
+        BuildLines(0);
+
+        TextLayout->UpdateIfNeeded();
+
+        //layouts with images own loader widgets, they can't be moved to another field.
+        //a cached layout is assumed to use the quantized scale of its format
+        bool bCacheable = bCacheEnabled && FontScale == QuantizedScale;
+        for (int32 ElementIndex = 0; bCacheable && ElementIndex < HTMLElements.Num(); ++ElementIndex)
+            bCacheable = HTMLElements[ElementIndex].Type != EHTMLElementType::Image;
+        if (bCacheable)
+            LayoutKey = MoveTemp(Key);
     }
 
-    BuildLines();
+    //the loader widgets of embedded images were detached or attached by the layout
+    if (bHadChildren || (OwnsTextLayout() && TextLayout->GetChildren()->Num() > 0))
+        ++HierarchyRevision;
 
-    TextLayout->UpdateIfNeeded();
+    OnTextLayoutUpdated();
+}
 
+void STextField::ParseText(const FString& InText)
+{
+    if (bUBB)
+    {
+        if (!FUBBParser::DefaultParser.ParseElements(InText, TextFormat, HTMLElements, FHTMLParser::DefaultParseOptions))
+            FHTMLParser::DefaultParser.Parse(FUBBParser::DefaultParser.Parse(InText), TextFormat, HTMLElements, FHTMLParser::DefaultParseOptions);
+    }
+    else if (bHTML)
+    {
+        FHTMLParser::DefaultParser.Parse(InText, TextFormat, HTMLElements, FHTMLParser::DefaultParseOptions);
+    }
+    else
+    {
+        FHTMLElement& TextElement = HTMLElements.Add(EHTMLElementType::Text);
+        TextElement.Format = TextFormat;
+        TextElement.Text.Append(InText);
+    }
+}
+
+void STextField::OnTextLayoutUpdated()
+{
+    const FVector2D TextSize = TextLayout->GetSize() * FontScale;
     if (AutoSize == EAutoSizeType::Both)
     {
-        GObject->SetSize(TextLayout->GetSize());
+        GObject->SetSize(TextSize);
     }
     else if (AutoSize == EAutoSizeType::Height)
     {
-        GObject->SetSize(FVector2D(Size.X, TextLayout->GetSize().Y));
+        GObject->SetSize(FVector2D(Size.X, TextSize.Y));
     }
+
+    InvalidatePaintBounds();
 }
 
-void STextField::BuildLines()
+FSlateRect STextField::GetLocalPaintBounds() const
+{
+    //text that doesn't fit is aligned inside the field and may spill out on either side
+    FVector2D Overflow = FVector2D::Max(TextLayout->GetSize() * FontScale - Size, FVector2D::ZeroVector);
+    return FSlateRect(-Overflow, Size + Overflow);
+}
+
+bool STextField::CanScaleElements(int32 FirstElement) const
+{
+    for (int32 ElementIndex = FirstElement; ElementIndex < HTMLElements.Num(); ++ElementIndex)
+    {
+        const FHTMLElement& Element = HTMLElements[ElementIndex];
+        if (Element.Type == EHTMLElementType::Image)
+            return false;
+        if (Element.Type == EHTMLElementType::Text
+            && (Element.Format.Size != TextFormat.Size || Element.Format.Face.StartsWith("ui://")))
+            return false;
+    }
+    return true;
+}
+
+void STextField::BuildLines(int32 FirstElement)
 {
     class FLineHelper
     {
@@ -264,14 +431,14 @@ void STextField::BuildLines()
     }
 
     TArray<FTextRange> LineRangesBuffer;
-    for (int32 ElementIndex = 0; ElementIndex < HTMLElements.Num(); ++ElementIndex)
+    for (int32 ElementIndex = FirstElement; ElementIndex < HTMLElements.Num(); ++ElementIndex)
     {
         const FHTMLElement& Element = HTMLElements[ElementIndex];
         if (Element.Type == EHTMLElementType::Text)
         {
             LineRangesBuffer.Reset();
 
-            FTextBlockStyle TextStyle = Element.Format.GetStyle();
+            FTextBlockStyle TextStyle = GetLayoutStyle(Element.Format, FontScale);
 
             FTextRange::CalculateLineRangesFromString(Element.Text, LineRangesBuffer);
 
@@ -279,26 +446,17 @@ void STextField::BuildLines()
             {
                 const FTextRange& LineRange = LineRangesBuffer[LineIndex];
                 FString TextBlock = Element.Text.Mid(LineRange.BeginIndex, LineRange.Len());
+                FTextRange ModelRange;
+                ModelRange.BeginIndex = LineHelper.GetText().Len();
+                LineHelper.GetText().Append(TextBlock);
+                ModelRange.EndIndex = LineHelper.GetText().Len();
+
                 if (BitmapFont.IsValid())
-                {
-                    int32 len = TextBlock.Len();
-                    for (int32 CharIndex = 0; CharIndex < len; CharIndex++)
-                    {
-                        FTextRange ModelRange;
-                        ModelRange.BeginIndex = LineHelper.GetText().Len();
-                        LineHelper.GetText().AppendChar(TextBlock[CharIndex]);
-                        ModelRange.EndIndex = LineHelper.GetText().Len();
-                        LineHelper.GetRuns().Add(FBitmapFontRun::Create(LineHelper.GetTextRef(), BitmapFont.ToSharedRef(), ModelRange));
-                    }
-                }
+                    LineHelper.GetRuns().Add(FBitmapFontRun::Create(LineHelper.GetTextRef(), BitmapFont.ToSharedRef(), ModelRange));
                 else
                 {
-                    FTextRange ModelRange;
-                    ModelRange.BeginIndex = LineHelper.GetText().Len();
-                    LineHelper.GetText().Append(TextBlock);
-                    ModelRange.EndIndex = LineHelper.GetText().Len();
-
                     LineHelper.GetRuns().Add(FSlateTextRun::Create(FRunInfo(), LineHelper.GetTextRef(), TextStyle, ModelRange));
+                    FGlyphCache::TrackGlyphs(TextStyle.Font, TextBlock, TextLayout->GetScale());
                 }
 
                 if (LineIndex != LineRangesBuffer.Num() - 1)
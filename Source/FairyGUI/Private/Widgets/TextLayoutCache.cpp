@@ -0,0 +1,102 @@
+#include "Widgets/TextLayoutCache.h"
+#include "Framework/Text/SlateTextLayout.h"
+#include "FairyApplication.h"
+#include "UI/UIConfig.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Text Layout Cache Hits"), STAT_FairyGUI_TextLayoutCacheHits, STATGROUP_FairyGUI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Text Layout Cache Misses"), STAT_FairyGUI_TextLayoutCacheMisses, STATGROUP_FairyGUI);
+DECLARE_MEMORY_STAT(TEXT("Text Layout Cache Memory"), STAT_FairyGUI_TextLayoutCacheMemory, STATGROUP_FairyGUI);
+
+FTextLayoutKey::FTextLayoutKey(const FString& InText, const FNTextFormat& InFormat, float InWrappingWidth, float InScale, EAutoSizeType InAutoSize, bool bInHTML, bool bInUBB, bool bInSingleLine) :
+    Text(InText),
+    Format(InFormat),
+    FormatHash(GetTypeHash(InFormat)),
+    WrappingWidth(InWrappingWidth),
+    Scale(InScale),
+    AutoSize(InAutoSize),
+    bHTML(bInHTML),
+    bUBB(bInUBB),
+    bSingleLine(bInSingleLine)
+{
+}
+
+bool FTextLayoutKey::operator==(const FTextLayoutKey& Other) const
+{
+    return FormatHash == Other.FormatHash && WrappingWidth == Other.WrappingWidth && Scale == Other.Scale
+        && AutoSize == Other.AutoSize && bHTML == Other.bHTML && bUBB == Other.bUBB && bSingleLine == Other.bSingleLine
+        && Text.Equals(Other.Text, ESearchCase::CaseSensitive) && Format == Other.Format;
+}
+
+uint32 GetTypeHash(const FTextLayoutKey& Key)
+{
+    uint32 Hash = HashCombine(FCrc::StrCrc32(*Key.Text), Key.FormatHash);
+    Hash = HashCombine(Hash, GetTypeHash(Key.WrappingWidth));
+    Hash = HashCombine(Hash, GetTypeHash(Key.Scale));
+    return HashCombine(Hash, (uint32)Key.AutoSize | ((uint32)Key.bHTML << 8) | ((uint32)Key.bUBB << 9) | ((uint32)Key.bSingleLine << 10));
+}
+
+FTextLayoutCache& FTextLayoutCache::Get()
+{
+    static FTextLayoutCache Instance;
+    return Instance;
+}
+
+FTextLayoutCache::~FTextLayoutCache()
+{
+    Empty();
+}
+
+TSharedPtr<FSlateTextLayout> FTextLayoutCache::Checkout(const FTextLayoutKey& Key)
+{
+    FEntryNode** Found = Index.Find(Key);
+    if (Found == nullptr)
+    {
+        MissCount++;
+        INC_DWORD_STAT(STAT_FairyGUI_TextLayoutCacheMisses);
+        return nullptr;
+    }
+
+    HitCount++;
+    INC_DWORD_STAT(STAT_FairyGUI_TextLayoutCacheHits);
+
+    FEntryNode* Node = *Found;
+    TSharedPtr<FSlateTextLayout> Layout = Node->GetValue().Layout;
+    RemoveNode(Node);
+    return Layout;
+}
+
+void FTextLayoutCache::Return(const FTextLayoutKey& Key, const TSharedRef<FSlateTextLayout>& Layout)
+{
+    const int64 Capacity = (int64)UFairyApplication::GetUIConfig().TextLayoutCacheSize * 1024;
+    //a rough estimate, the shaped glyphs and line views grow with the length of the text
+    const int32 Cost = 1024 + (Key.Text.Len() + Key.Format.Face.Len()) * 96;
+    if (Cost > Capacity)
+        return;
+
+    Entries.AddHead(FEntry{ Key, Layout, Cost });
+    Index.Add(Key, Entries.GetHead());
+    MemorySize += Cost;
+
+    while (MemorySize > Capacity)
+        RemoveNode(Entries.GetTail());
+
+    SET_MEMORY_STAT(STAT_FairyGUI_TextLayoutCacheMemory, MemorySize);
+}
+
+void FTextLayoutCache::Empty()
+{
+    Entries.Empty();
+    Index.Empty();
+    MemorySize = 0;
+
+    SET_MEMORY_STAT(STAT_FairyGUI_TextLayoutCacheMemory, 0);
+}
+
+void FTextLayoutCache::RemoveNode(FEntryNode* Node)
+{
+    MemorySize -= Node->GetValue().Cost;
+    Index.RemoveSingle(Node->GetValue().Key, Node);
+    Entries.RemoveNode(Node);
+
+    SET_MEMORY_STAT(STAT_FairyGUI_TextLayoutCacheMemory, MemorySize);
+}
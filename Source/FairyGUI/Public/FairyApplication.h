@@ -30,7 +30,10 @@ private:
 		bool bToClearCaptors;
 		FVector2D DownPosition;
 		bool bClickCancelled;
+		bool bMovePending;
 		int32 ClickCount;
+		FVector2D Velocity;
+		double LastMoveTime;
 		TArray<TWeakPtr<SWidget>> DownPath;
 		TArray<TWeakObjectPtr<UGObject>> MouseCaptors;
 		FPointerEvent Event;
@@ -65,9 +68,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FairyGUI")
 	UDragDropManager* GetDragDropManager() const { return DragDropManager; }
 
+	FTweenManager* GetTweenManager() const { return TweenManager.Get(); }
+
 	UFUNCTION(BlueprintCallable, Category = "FairyGUI")
 	FVector2D GetTouchPosition(int32 InUserIndex = -1, int32 InPointerIndex = -1);
 
+	UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+	FVector2D GetTouchVelocity(int32 InUserIndex = -1, int32 InPointerIndex = -1);
+
 	UFUNCTION(BlueprintCallable, Category = "FairyGUI")
 	int32 GetTouchCount() const;
 
@@ -159,15 +167,21 @@ private:
 	void PreviewDownEvent(const FPointerEvent& MouseEvent);
 	void PreviewUpEvent(const FPointerEvent& MouseEvent);
 	void PreviewMoveEvent(const FPointerEvent& MouseEvent);
+	void DispatchTouchMove(FTouchInfo* TouchInfo);
 
 	UEventContext* BorrowEventContext();
 	void ReturnEventContext(UEventContext* Context);
 
 	void InternalBubbleEvent(const FName& EventType, const TArray<UGObject*>& CallChain, const FNVariant& Data);
 
+	TArray<UGObject*>& BorrowCallChain();
+	void ReturnCallChain();
+	void GetPathToRoot(const TSharedRef<SWidget>& Initiator, TArray<UGObject*>& OutCallChain);
+
 	FTouchInfo* GetTouchInfo(const FPointerEvent& MouseEvent);
 	FTouchInfo* GetTouchInfo(int32 InUserIndex, int32 InPointerIndex);
 
+	void OnSlatePreTick(float DeltaTime);
 	void OnSlatePostTick(float DeltaTime);
 
 private:
@@ -180,10 +194,17 @@ private:
 	UPROPERTY(Transient)
 	TObjectPtr<UGameViewportClient> CachedViewportClient;
 
+	TUniquePtr<FTweenManager> TweenManager;
 	TSharedPtr<IInputProcessor> InputProcessor;
 	TIndirectArray<FTouchInfo> Touches;
 	FTouchInfo* LastTouch;
+	TIndirectArray<TArray<UGObject*>> CallChainStack;
+	int32 CallChainDepth;
+	TWeakPtr<SWidget> HoverPathWidget;
+	TArray<TWeakObjectPtr<UGObject>> HoverPath;
+	uint32 HoverPathRevision;
 	bool bNeedCheckPopups;
+	FDelegateHandle PreTickDelegateHandle;
 	FDelegateHandle PostTickDelegateHandle;
 	FSimpleMulticastDelegate PostTickMulticastDelegate;
 	bool bSoundEnabled;
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Stats/Stats.h"
 
 FAIRYGUI_API DECLARE_LOG_CATEGORY_EXTERN(LogFairyGUI, Log, All)
 
+DECLARE_STATS_GROUP(TEXT("FairyGUI"), STATGROUP_FairyGUI, STATCAT_Advanced);
+
 extern const FString FAIRYGUI_API G_EMPTY_STRING;
 
 DECLARE_DELEGATE_RetVal_OneParam(class UGComponent*, FGComponentCreator, UObject*);
\ No newline at end of file
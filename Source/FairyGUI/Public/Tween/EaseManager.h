@@ -7,4 +7,9 @@ class FAIRYGUI_API EaseManager
 {
 public:
     static float Evaluate(EEaseType EaseType, float Time, float Duration, float OvershootOrAmplitude, float Period);
+
+    //Evaluates Count values of the same ease type into OutRatio. Count must be a multiple of 4.
+    //Polynomial ease types are computed four at a time with vector math, the rest fall back to Evaluate.
+    static void EvaluateBatch(EEaseType EaseType, const float* Time, const float* Duration, const float* OvershootOrAmplitude, const float* Period,
+        float* OutRatio, int32 Count);
 };
@@ -8,14 +8,15 @@
 class FAIRYGUI_API FGTween
 {
 public:
-    static FGTweener* To(float StartValue, float EndValue, float Duration);
-    static FGTweener* To(const FVector2D& StartValue, const FVector2D& EndValue, float Duration);
-    static FGTweener* To(const FVector& StartValue, const FVector& EndValue, float Duration);
-    static FGTweener* To(const FVector4& StartValue, const FVector4& EndValue, float Duration);
-    static FGTweener* To(const FColor& StartValue, const FColor& EndValue, float Duration);
-    static FGTweener* ToDouble(double StartValue, double EndValue, float Duration);
-    static FGTweener* DelayedCall(float Delay);
-    static FGTweener* Shake(const FVector2D& StartValue, float Amplitude, float Duration);
+    //Tweens are created in the tween manager of WorldContext's world, see FTweenManager::Get
+    static FGTweener* To(float StartValue, float EndValue, float Duration, const UObject* WorldContext = nullptr);
+    static FGTweener* To(const FVector2D& StartValue, const FVector2D& EndValue, float Duration, const UObject* WorldContext = nullptr);
+    static FGTweener* To(const FVector& StartValue, const FVector& EndValue, float Duration, const UObject* WorldContext = nullptr);
+    static FGTweener* To(const FVector4& StartValue, const FVector4& EndValue, float Duration, const UObject* WorldContext = nullptr);
+    static FGTweener* To(const FColor& StartValue, const FColor& EndValue, float Duration, const UObject* WorldContext = nullptr);
+    static FGTweener* ToDouble(double StartValue, double EndValue, float Duration, const UObject* WorldContext = nullptr);
+    static FGTweener* DelayedCall(float Delay, const UObject* WorldContext = nullptr);
+    static FGTweener* Shake(const FVector2D& StartValue, float Amplitude, float Duration, const UObject* WorldContext = nullptr);
 
     static bool IsTweening(const FTweenerHandle& Handle);
     static bool IsTweening(UObject* Target);
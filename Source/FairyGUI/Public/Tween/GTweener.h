@@ -8,9 +8,23 @@
 
 class FGPath;
 class FGTweener;
+class FTweenManager;
 
 DECLARE_DELEGATE_OneParam(FTweenDelegate, FGTweener*);
 
+/** How a tween advances in its manager's tick. */
+enum class ETweenTickGroup : uint8
+{
+    //every frame, also while the world is paused
+    UI,
+    //every frame, frozen while the world is paused
+    Gameplay,
+    //at FUIConfig::TweenBackgroundTickRate under a per-frame time budget, for off-screen or hidden content
+    Background,
+
+    Count
+};
+
 class FAIRYGUI_API FGTweener
 {
 public:
@@ -34,6 +48,8 @@ public:
     FGTweener* SetTimeScale(float InValue);
     FGTweener* SetSnapping(bool InValue);
     FGTweener* SetTarget(UObject* InTarget);
+    FGTweener* SetTickGroup(ETweenTickGroup InValue);
+    ETweenTickGroup GetTickGroup() const { return TickGroup; }
     UObject* GetTarget() const { return Target.Get(); }
     const FNVariant& GetUserData() const { return UserData; }
     FGTweener* SetUserData(const FNVariant& InData);
@@ -70,8 +86,22 @@ private:
     void Update(float DeltaTime);
     void Update();
 
+    //Batched update used by FTweenManager::Tick: time is advanced per tweener, easing and interpolation
+    //are evaluated for a whole bucket, then the values are applied and callbacks dispatched.
+    bool CanBatchUpdate() const;
+    bool BeginBatchUpdate(float DeltaTime, float& OutEaseTime);
+    void EndBatchUpdate(float InNormalizedTime, const float* InValues);
+
+    bool UpdateTime(float& OutEaseTime);
+    void UpdateValue(const float* InValues);
+    void FinishUpdate();
+
 private:
+    FTweenManager* Manager;
     TWeakObjectPtr<UObject> Target;
+    UObject* IndexedTarget;
+    ETweenTickGroup TickGroup;
+    float PendingTime;
     bool bKilled;
     bool bPaused;
 
@@ -7,12 +7,19 @@
 
 class UGObject;
 
+/** Tweens of one world. Each UFairyApplication owns one, tweens created without a world go to a shared default manager. */
 class FAIRYGUI_API FTweenManager : public FTickableGameObject
 {
 public:
-    static FTweenManager Singleton;
+    //Manager of the world the context object lives in. Without a context, the manager currently ticking
+    //(so tweens created in tween callbacks stay in the same world), otherwise the default manager.
+    static FTweenManager& Get(const UObject* WorldContext);
+    //Manager that created the tween of this handle, nullptr if it has been destroyed
+    static FTweenManager* Get(const FTweenerHandle& Handle);
+    //Manager of tweens that belong to no world
+    static FTweenManager& GetDefault() { return DefaultManager; }
 
-    FTweenManager();
+    FTweenManager(UWorld* InWorld = nullptr);
     virtual ~FTweenManager();
     void Reset();
 
@@ -27,15 +34,71 @@ public:
     FGTweener* GetTween(FTweenerHandle const& Handle);
     FGTweener* GetTween(UObject* Target);
 
-    void Tick(float DeltaTime);
-    TStatId GetStatId() const {
-        return TStatId();
+    int32 GetTweenCount() const { return TotalActiveTweens; }
+    int32 GetTweenCount(ETweenTickGroup TickGroup) const { return GroupTweenCount[(int32)TickGroup]; }
+    //seconds spent in the last Tick
+    double GetLastTickTime() const { return LastTickTime; }
+
+    virtual void Tick(float DeltaTime) override;
+    virtual UWorld* GetTickableGameObjectWorld() const override { return World.Get(); }
+    virtual bool IsTickableWhenPaused() const override { return true; }
+    virtual TStatId GetStatId() const override {
+        RETURN_QUICK_DECLARE_CYCLE_STAT(FTweenManager, STATGROUP_Tickables);
     }
 
 private:
+    //Tweeners of the same ease type and value size, stored as parallel arrays so that
+    //easing and interpolation run over contiguous memory
+    struct FTweenBucket
+    {
+        TArray<FGTweener*> Tweeners;
+        TArray<float> Time;
+        TArray<float> Duration;
+        TArray<float> OvershootOrAmplitude;
+        TArray<float> Period;
+        TArray<float> Ratio;
+        TArray<float> Start[4];
+        TArray<float> End[4];
+        TArray<float> Output[4];
+
+        void Reset(int32 ValueSize);
+        void Pad(int32 ValueSize);
+    };
+
+    void UpdateTweener(FGTweener* Tweener, float DeltaTime);
+    void UpdateBackgroundTweens(float Interval, float MaxStepTime, float Budget);
+    void AddToBatch(FGTweener* Tweener, float EaseTime);
+    void UpdateBatch();
+
+    void AddToTargetIndex(FGTweener* Tweener, UObject* Target);
+    void RemoveFromTargetIndex(FGTweener* Tweener);
+
+    static FTweenManager DefaultManager;
+    static FTweenManager* Managers[FTweenerHandle::MaxManagerId];
+    static FTweenManager* TickingManager;
+
+    TWeakObjectPtr<UWorld> World;
+    int32 ManagerId;
+
     FGTweener** ActiveTweens;
+    //tweener instance by handle index, the serial number in the handle tells a live tween from a recycled one
+    TArray<FGTweener*> HandleSlots;
+    //live tweens of each target, entries are removed when a tween is killed, retargeted or recycled
+    TMultiMap<UObject*, FGTweener*> TargetTweens;
+    FTweenBucket Buckets[(int32)EEaseType::Custom + 1][4];
+    TArray<FTweenBucket*> ActiveBuckets;
     TArray<FGTweener*> TweenerPool;
     int32 TotalActiveTweens;
     int32 ArrayLength;
     uint32 TweenerInstanceCount;
+    int32 GroupTweenCount[(int32)ETweenTickGroup::Count];
+    //where the next Background pass starts
+    int32 BackgroundCursor;
+    double LastTickTime;
+
+    //a Background tween applies at most this many intervals (or frames) of pending time per update,
+    //time beyond that is carried into its following updates rather than dropped
+    static constexpr int32 MaxBackgroundCatchUpSteps = 4;
+
+    friend class FGTweener;
 };
\ No newline at end of file
@@ -45,31 +45,38 @@ private:
         return (int32)(Handle & (uint64)(MaxIndex - 1));
     }
 
+    FORCEINLINE int32 GetManagerId() const
+    {
+        return (int32)((Handle >> IndexBits) & (uint64)(MaxManagerId - 1));
+    }
+
     FORCEINLINE uint64 GetSerialNumber() const
     {
-        return Handle >> IndexBits;
+        return Handle >> (IndexBits + ManagerIdBits);
     }
 
     static const uint32 IndexBits = 24;
-    static const uint32 SerialNumberBits = 40;
+    static const uint32 ManagerIdBits = 8;
+    static const uint32 SerialNumberBits = 32;
     static const int32  MaxIndex = (int32)1 << IndexBits;
+    static const int32  MaxManagerId = (int32)1 << ManagerIdBits;
     static const uint64 MaxSerialNumber = (uint64)1 << SerialNumberBits;
 
-    void SetIndex(int32 Index)
+    void SetIndex(int32 Index, int32 ManagerId)
     {
-        Handle = (uint64)(uint32)Index;
+        Handle = ((uint64)(uint32)ManagerId << IndexBits) | (uint64)(uint32)Index;
     }
 
     void IncreaseSerialNumber()
     {
-        int32 Index = (int32)(Handle & (uint64)(MaxIndex - 1));
-        uint64 SerialNumber = Handle >> IndexBits;
+        uint64 Low = Handle & (((uint64)1 << (IndexBits + ManagerIdBits)) - 1);
+        uint64 SerialNumber = GetSerialNumber();
         SerialNumber++;
         if (!ensureMsgf(SerialNumber != FTweenerHandle::MaxSerialNumber, TEXT("Tweener serial number has wrapped around!")))
         {
             SerialNumber = 0;
         }
-        Handle = (SerialNumber << IndexBits) | (uint64)(uint32)Index;
+        Handle = (SerialNumber << (IndexBits + ManagerIdBits)) | Low;
     }
 
     uint64 Handle;
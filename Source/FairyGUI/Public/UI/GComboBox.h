@@ -50,7 +50,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     UGController* GetSelectionController() const { return SelectionController; }
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
-    void SetSelectionController(UGController* InController) { SelectionController = InController; }
+    void SetSelectionController(UGController* InController);
 
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     UGObject* GetDropdown() const { return DropdownObject; }
@@ -108,6 +108,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     void SetOpaque(bool bInOpaque);
 
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    bool IsLayerBatching() const;
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void SetLayerBatching(bool bInLayerBatching);
+
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     const FMargin& GetMargin() { return Margin; }
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
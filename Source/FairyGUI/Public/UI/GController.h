@@ -6,8 +6,23 @@
 #include "GController.generated.h"
 
 class UGComponent;
+class UGObject;
 class FByteBuffer;
 
+//the page table of a controller, decoded once per component template
+struct FControllerRecord
+{
+    FString Name;
+    bool bAutoRadioGroupDepth = false;
+    TArray<FString> PageIDs;
+    TArray<FString> PageNames;
+    int32 HomePageType = 0;
+    int32 HomePageIndex = 0;
+    FString HomePageVar;
+    //position of the action block, actions are created from the buffer
+    int32 ActionsPos = -1;
+};
+
 UCLASS(BlueprintType)
 class FAIRYGUI_API UGController : public UObject
 {
@@ -41,7 +56,17 @@ public:
     void SetOppositePageID(const FString& PageID);
     void RunActions();
 
+    //Objects that react to this controller: owners of gears bound to it, buttons related to it, lists and combo boxes using it
+    //as selection controller, and components whose scroll pane uses it as page controller. A page change only reaches these.
+    //Each binding adds a reference, the object is notified while it has any and is a child of the controller's component.
+    void AddSubscriber(UGObject* Obj);
+    void RemoveSubscriber(UGObject* Obj);
+    int32 GetSubscriberCount() const { return Subscribers.Num(); }
+    UGObject* GetSubscriberAt(int32 Index) const { return Subscribers[Index].Object.Get(); }
+
     void Setup(FByteBuffer* Buffer);
+    void Setup(const FControllerRecord& Record, FByteBuffer* Buffer);
+    static void Decode(FByteBuffer* Buffer, FControllerRecord& OutRecord);
 
     FString Name;
     bool bChanging;
@@ -55,11 +80,18 @@ public:
     FOnChanged& OnChanged() { return OnChangedEvent; }
 
 private:
+    struct FSubscriber
+    {
+        TWeakObjectPtr<UGObject> Object;
+        int32 RefCount;
+    };
+
     int32 SelectedIndex;
     int32 PreviousIndex;
     TArray<FString> PageIDs;
     TArray<FString> PageNames;
     TIndirectArray<FControllerAction> Actions;
+    TArray<FSubscriber> Subscribers;
 
     FOnChanged OnChangedEvent;
 };
\ No newline at end of file
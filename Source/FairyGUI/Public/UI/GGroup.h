@@ -55,6 +55,8 @@ public:
 
     void MoveChildren(const FVector2D& Delta);
     void ResizeChildren(const FVector2D& Delta);
+    void OnMemberChanged(UGObject* Member, bool bPositionChangedOnly = false);
+    void InvalidateMembers();
 
     uint8 Updating;
 
@@ -65,6 +67,9 @@ protected:
     virtual void HandleVisibleChanged() override;
 
 private:
+    void MarkBoundsChanged(bool bPositionChangedOnly);
+    void EnsureMembers();
+    FBox2D GetMemberBounds(UGObject* Member) const;
     void UpdateBounds();
     void HandleLayout();
 
@@ -82,5 +87,14 @@ private:
     float TotalSize;
     int32 NumChildren;
 
+    //members in parent child order, rebuilt when membership or order changes
+    TArray<UGObject*> Members;
+    TArray<FBox2D> MemberBounds;
+    TBitArray<> DirtyMembers;
+    FBox2D Extent;
+    int32 FirstDirtyMember;
+    bool bMembersValid;
+    TWeakObjectPtr<UGComponent> MembersParent;
+
     FTimerHandle UpdateBoundsTimerHandle;
 };
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "GComponent.h"
+#include "Utils/PrefixSumIndex.h"
 #include "GList.generated.h"
 
 class FGObjectPool;
@@ -75,6 +76,10 @@ public:
     UGObject* GetFromPool(const FString& URL);
     void ReturnToPool(UGObject* Obj);
 
+    /** Keeps Count idle instances of URL (the default item if empty) ready, built over the next frames. MaxIdle caps the pooled instances, 0 keeps all of them. */
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void PrewarmPool(int32 Count, const FString& URL = "", bool bHighPriority = false, int32 MaxIdle = 0);
+
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     UGObject* AddItemFromPool(const FString& URL = "");
 
@@ -218,9 +223,16 @@ private:
 
     void OnScrollHandler(UEventContext* Context);
 
-    int32 GetIndexOnPos1(float& pos, bool forceUpdate);
-    int32 GetIndexOnPos2(float& pos, bool forceUpdate);
-    int32 GetIndexOnPos3(float& pos, bool forceUpdate);
+    UGObject* GetItemObject(int32 ItemIndex) const;
+    UGObject* DetachItemObject(int32 ItemIndex);
+    bool IsItemSelected(int32 ItemIndex) const;
+
+    void UpdateLineIndex();
+    void UpdateLineSize(int32 ItemIndex);
+
+    int32 GetIndexOnPos1(float& pos);
+    int32 GetIndexOnPos2(float& pos);
+    int32 GetIndexOnPos3(float& pos);
 
     void HandleScroll(bool forceUpdate);
     bool HandleScroll1(bool forceUpdate);
@@ -263,16 +275,23 @@ private:
     uint32 ItemInfoVer;
     FTimerHandle RefreshTimerHandle;
 
-    struct FItemInfo
+    struct FItemObject
     {
-        FVector2D Size;
         UGObject* Obj;
         uint32 UpdateFlag;
-        bool bSelected;
-
-        FItemInfo();
     };
-    TArray<FItemInfo> VirtualItems;
+    //item sizes, one entry per virtual item
+    TArray<FVector2f> ItemSizes;
+    //selection of the virtual items, authoritative only for items that have no live object
+    TBitArray<> ItemSelected;
+    //the items that currently own a child object, keyed by item index
+    TMap<int32, FItemObject> ItemObjects;
+    //items of the two pages HandleScroll3 lays out, kept to avoid reallocating on every scroll
+    TBitArray<> ItemInView;
+
+    //offsets of the lines along the scrolling axis, rebuilt when the item count or layout changes
+    FPrefixSumIndex LineIndex;
+    bool bLineIndexDirty;
 
     UPROPERTY()
     UObject* Payload;
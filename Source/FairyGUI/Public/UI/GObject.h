@@ -14,6 +14,7 @@
 class FByteBuffer;
 class FRelations;
 class FGearBase;
+struct FEventDelegateTable;
 
 class UGGroup;
 class UGComponent;
@@ -254,8 +255,11 @@ public:
     bool DispatchEvent(const FName& EventType, const FNVariant& Data = FNVariant::Null);
     bool HasEventListener(const FName& EventType) const;
     void InvokeEventDelegate(UEventContext* Context);
+    void InvokeEventDelegate(UEventContext* Context, int32 EventTypeIndex);
     FGUIEventMDelegate& On(const FName& EventType);
 
+    static int32 GetEventTypeIndex(const FName& EventType);
+
     FSimpleMulticastDelegate& OnPositionChanged()
     {
         return OnPositionChangedEvent;
@@ -347,6 +351,8 @@ protected:
     virtual void HandleSizeChanged();
     virtual void HandleGrayedChanged();
     virtual void HandlePositionChanged();
+    //only called for controllers the object subscribed to with UGController::AddSubscriber, overrides that react to
+    //another controller of the parent must subscribe to it
     virtual void HandleControllerChanged(UGController* Controller);
     virtual void HandleAlphaChanged();
     virtual void HandleVisibleChanged();
@@ -397,9 +403,12 @@ private:
     uint8 bInternalVisible : 1;
     uint8 bHandlingController : 1;
     uint8 bDraggable : 1;
+    //marks the subscribers of the controller the parent is applying
+    uint32 ControllerStamp;
     int32 SortingOrder;
     FString Tooltips;
     TWeakObjectPtr<UGGroup> Group;
+    int32 IndexInGroup;
     float SizePercentInGroup;
     TSharedPtr<FRelations> Relations;
     TSharedPtr<FGearBase> Gears[10];
@@ -411,13 +420,17 @@ private:
     UPROPERTY(Transient)
     TObjectPtr<UFairyApplication> CachedApplication;
 
-    struct FUnifiedEventDelegate
+    struct FNativeEventDelegate
     {
+        FName EventType;
         FGUIEventMDelegate Func;
-        FGUIEventDynMDelegate* DynFunc;
     };
-    TMap<FName, FUnifiedEventDelegate> EventDelegates;
-    FUnifiedEventDelegate& GetEventDelegate(const FName& EventType);
+    TArray<FNativeEventDelegate> NativeEventDelegates;
+    uint64 NativeEventMask;
+    mutable const FEventDelegateTable* EventDelegateTable;
+    const FEventDelegateTable& GetEventDelegateTable() const;
+    FGUIEventMDelegate* FindNativeEventDelegate(const FName& EventType) const;
+    FGUIEventDynMDelegate* FindDynamicEventDelegate(const FName& EventType, int32 EventTypeIndex) const;
 
     FSimpleMulticastDelegate OnPositionChangedEvent;
     FSimpleMulticastDelegate OnSizeChangedEvent;
@@ -429,6 +442,7 @@ private:
 
     friend class UGComponent;
     friend class UGGroup;
+    friend class FRelations;
     friend class FRelationItem;
     friend class FUIObjectFactory;
     friend class UGTree;
@@ -2,19 +2,76 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Containers/Ticker.h"
 
 class UGObject;
 
+struct FGObjectPoolStats
+{
+    /** GetObject calls served from idle instances. */
+    int32 Hits = 0;
+    /** GetObject calls that had to construct a new instance. */
+    int32 Misses = 0;
+    /** Instances constructed by the pool, on demand or while pre-warming. */
+    int32 Constructions = 0;
+    /** Idle instances released by ReturnObject overflow or trimming. */
+    int32 Released = 0;
+};
+
 class FGObjectPool : public FGCObject
 {
 public:
+    FGObjectPool();
+    virtual ~FGObjectPool();
+
     UGObject* GetObject(const FString& URL, UObject* WorldContextObject);
     void ReturnObject(UGObject* Obj);
 
+    /**
+     * Keeps at least LowWatermark idle instances of URL. Missing instances are constructed a few per frame
+     * within FUIConfig::PoolPrewarmFrameBudget, high priority requests first.
+     * Returned objects beyond HighWatermark are released instead of pooled, by default every one is kept.
+     */
+    void Prewarm(const FString& URL, int32 LowWatermark, UObject* WorldContextObject, bool bHighPriority = false, int32 HighWatermark = MAX_int32);
+    void CancelPrewarm(const FString& URL);
+
+    /** Releases idle instances above each URL's low watermark, or those unused for at least IdleSeconds. */
+    void Trim(float IdleSeconds = 0);
+    void Clear();
+
+    int32 GetIdleCount(const FString& URL) const;
+    const FGObjectPoolStats& GetStats() const { return Stats; }
+    void ResetStats() { Stats = FGObjectPoolStats(); }
+
     virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
 
     virtual FString GetReferencerName() const override;
 
 private:
-    TMap<FString, TArray<TObjectPtr<UGObject>>> Pool;
-};
\ No newline at end of file
+    struct FEntry
+    {
+        TArray<TObjectPtr<UGObject>> Objects;
+        int32 LowWatermark = 0;
+        int32 HighWatermark = MAX_int32;
+        bool bHighPriority = false;
+        bool bPrewarming = false;
+        double LastUsedTime = 0;
+        TWeakObjectPtr<UObject> WorldContextObject;
+    };
+
+    void ReleaseObjects(FEntry& Entry, int32 KeepCount);
+    bool PrewarmStep(double EndTime, bool bHighPriority);
+    void SchedulePrewarm();
+
+    static bool TickPrewarm(float DeltaTime);
+    static void OnMemoryTrim();
+
+    TMap<FString, FEntry> Pool;
+    FGObjectPoolStats Stats;
+    bool bScheduled;
+
+    static TArray<FGObjectPool*> AllPools;
+    static TArray<FGObjectPool*> PrewarmingPools;
+    static FTSTicker::FDelegateHandle TickerHandle;
+    static FDelegateHandle MemoryTrimHandle;
+};
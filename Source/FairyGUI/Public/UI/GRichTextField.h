@@ -12,6 +12,11 @@ public:
     UGRichTextField();
     virtual ~UGRichTextField();
 
+    //Adds a line to the end of the text, e.g. for chat logs. Only the new line is parsed and laid out,
+    //so markup in it should be complete, tags are not carried over from earlier lines.
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void AppendLine(const FString& InLine);
+
     UPROPERTY(BlueprintAssignable, Category = "FairyGUI|Event")
     FGUIEventDynMDelegate OnClickLink;
 
@@ -52,22 +52,41 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     void FlushVars();
 
+    //null when the text is not a template
+    const TMap<FString, FString>* GetVars() const { return TemplateVars.GetPtrOrNull(); }
+    //replaces every variable, applied by the next FlushVars like SetVar
+    void SetVars(const TMap<FString, FString>& InVars);
+
     virtual FNVariant GetProp(EObjectPropID PropID) const override;
     virtual void SetProp(EObjectPropID PropID, const FNVariant& InValue) override;
 
-    TOptional<TMap<FString, FString>> TemplateVars;
-
 protected:
     virtual void SetupBeforeAdd(FByteBuffer* Buffer, int32 BeginPos) override;
     virtual void SetupAfterAdd(FByteBuffer* Buffer, int32 BeginPos) override;
 
     void UpdateSize();
-    FString ParseTemplate(const FString& Template);
+    void CompileTemplate();
+    const FString& ApplyTemplate();
 
     FString Text;
     bool bUBBEnabled;
     bool bFormatApplied;
     bool bSupportHTML;
 
+    //Text split at its {var} and {var=default} markers, built once per text
+    struct FTemplateSegment
+    {
+        //literal text, or the default of a variable
+        FString Text;
+        //empty for literal text
+        FString VarKey;
+    };
+    TArray<FTemplateSegment> TemplateSegments;
+    FString TemplateBuffer;
+    //only changed through SetVar and SetVars, so FlushVars knows when it has work to do
+    TOptional<TMap<FString, FString>> TemplateVars;
+    bool bTemplateCompiled;
+    bool bTemplateVarsChanged;
+
     TSharedPtr<class STextField> Content;
 };
\ No newline at end of file
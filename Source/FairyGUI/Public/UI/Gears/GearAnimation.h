@@ -12,7 +12,7 @@ public:
     virtual void UpdateState() override;
 
 protected:
-    virtual void AddStatus(const FString& PageID, FByteBuffer* Buffer) override;
+    virtual void AddStatus(int32 PageIndex, FByteBuffer* Buffer) override;
     virtual void Init() override;
 
 private:
@@ -23,6 +23,6 @@ private:
 
         FValue();
     };
-    TMap<FString, FValue> Storage;
+    TGearStorage<FValue> Storage;
     FValue Default;
 };
\ No newline at end of file
@@ -21,6 +21,56 @@ public:
     FTweenerHandle Handle;
 };
 
+/** Per-page values of a gear, stored densely by page index of the gear's controller. Pages without a value fall back to the gear's default. */
+template<typename T>
+class TGearStorage
+{
+public:
+    TGearStorage() : NumValues(0) {}
+
+    void Reset(int32 PageCount)
+    {
+        Values.Reset();
+        Values.SetNum(PageCount);
+        HasValue.Init(false, PageCount);
+        NumValues = 0;
+    }
+
+    int32 Num() const { return NumValues; }
+
+    T* Find(int32 PageIndex)
+    {
+        return HasValue.IsValidIndex(PageIndex) && HasValue[PageIndex] ? &Values[PageIndex] : nullptr;
+    }
+
+    //values of unknown pages are dropped
+    template<typename ValueType>
+    void Add(int32 PageIndex, ValueType&& Value)
+    {
+        if (!HasValue.IsValidIndex(PageIndex))
+            return;
+
+        if (!HasValue[PageIndex])
+        {
+            HasValue[PageIndex] = true;
+            NumValues++;
+        }
+        Values[PageIndex] = Forward<ValueType>(Value);
+    }
+
+    template<typename FuncType>
+    void ForEach(FuncType Func)
+    {
+        for (TConstSetBitIterator<> It(HasValue); It; ++It)
+            Func(Values[It.GetIndex()]);
+    }
+
+private:
+    TArray<T> Values;
+    TBitArray<> HasValue;
+    int32 NumValues;
+};
+
 class FGearBase
 {
 public:
@@ -58,8 +108,10 @@ public:
     static bool bDisableAllTweenEffect;
 
 protected:
-    virtual void AddStatus(const FString& PageID, FByteBuffer* Buffer);
+    //PageIndex is INDEX_NONE for the default status
+    virtual void AddStatus(int32 PageIndex, FByteBuffer* Buffer);
     virtual void Init();
+    int32 ResolvePageIndex(const FString& PageID) const;
 
     EType Type;
     UGObject* Owner;
@@ -15,13 +15,19 @@ public:
     void ReleaseLock(uint32 Token);
     bool IsConnected();
 
-    TArray<FString> Pages;
+    const TArray<FString>& GetPages() const { return Pages; }
+    void SetPages(const TArray<FString>& InPages);
 
 protected:
-    virtual void AddStatus(const FString& PageID, FByteBuffer* Buffer) override;
+    virtual void AddStatus(int32 PageIndex, FByteBuffer* Buffer) override;
     virtual void Init() override;
 
 private:
+    void ResolvePages();
+
+    TArray<FString> Pages;
+    //Pages resolved to page indices of the controller
+    TBitArray<> VisiblePages;
     int32 Visible;
     uint32 DisplayLockToken;
 };
\ No newline at end of file
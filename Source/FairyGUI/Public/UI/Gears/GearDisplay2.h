@@ -12,13 +12,19 @@ public:
     virtual void UpdateState() override;
     bool Evaluate(bool bConnected);
 
-    TArray<FString> Pages;
+    const TArray<FString>& GetPages() const { return Pages; }
+    void SetPages(const TArray<FString>& InPages);
     int32 Condition;
 
 protected:
-    virtual void AddStatus(const FString& pageID, FByteBuffer* Buffer) override;
+    virtual void AddStatus(int32 PageIndex, FByteBuffer* Buffer) override;
     virtual void Init() override;
 
 private:
+    void ResolvePages();
+
+    TArray<FString> Pages;
+    //Pages resolved to page indices of the controller
+    TBitArray<> VisiblePages;
     int32 Visible;
 };
\ No newline at end of file
@@ -12,10 +12,10 @@ public:
     virtual void UpdateState() override;
 
 protected:
-    virtual void AddStatus(const FString& PageID, FByteBuffer* Buffer) override;
+    virtual void AddStatus(int32 PageIndex, FByteBuffer* Buffer) override;
     virtual void Init() override;
 
 private:
-    TMap<FString, int32> Storage;
+    TGearStorage<int32> Storage;
     int32 Default;
 };
\ No newline at end of file
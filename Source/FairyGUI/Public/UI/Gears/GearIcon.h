@@ -12,10 +12,10 @@ public:
     virtual void UpdateState() override;
 
 protected:
-    virtual void AddStatus(const FString& PageID, FByteBuffer* Buffer) override;
+    virtual void AddStatus(int32 PageIndex, FByteBuffer* Buffer) override;
     virtual void Init() override;
 
 private:
-    TMap<FString, FString> Storage;
+    TGearStorage<FString> Storage;
     FString Default;
 };
\ No newline at end of file
@@ -13,16 +13,16 @@ public:
     virtual void UpdateFromRelations(const FVector2D& Delta) override;
 
     bool bPositionsInPercent;
-    void AddExtStatus(const FString& PageID, FByteBuffer* Buffer);
+    void AddExtStatus(int32 PageIndex, FByteBuffer* Buffer);
 
 protected:
-    virtual void AddStatus(const FString& PageID, FByteBuffer* Buffer) override;
+    virtual void AddStatus(int32 PageIndex, FByteBuffer* Buffer) override;
     virtual void Init() override;
 
 private:
     void OnTweenUpdate(FGTweener* Tweener);
     void OnTweenComplete();
 
-    TMap<FString, FVector4> Storage;
+    TGearStorage<FVector4> Storage;
     FVector4 Default;
 };
\ No newline at end of file
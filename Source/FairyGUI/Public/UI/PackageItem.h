@@ -10,6 +10,7 @@
 class FByteBuffer;
 struct FMovieClipData;
 struct FBitmapFont;
+struct FComponentTemplate;
 
 class UUIPackage;
 class UNTexture;
@@ -56,6 +57,7 @@ public:
     //component
     FGComponentCreator ExtensionCreator;
     bool bTranslated;
+    TSharedPtr<FComponentTemplate> ComponentTemplate;
 
     //font
     TSharedPtr<FBitmapFont> BitmapFont;
@@ -39,12 +39,18 @@ private:
     void ReleaseRefTarget();
     void OnTargetXYChanged();
     void OnTargetSizeChanged();
+    void ApplyTargetXY();
+    void ApplyTargetSize();
 
     UGObject* Owner;
     TWeakObjectPtr<UGObject> Target;
     TArray<FRelationDef> Defs;
     FVector4 TargetData;
+    uint8 bXYDirty : 1;
+    uint8 bSizeDirty : 1;
 
     FDelegateHandle PositionDelegateHandle;
     FDelegateHandle SizeDelegateHandle;
+
+    friend class FRelations;
 };
\ No newline at end of file
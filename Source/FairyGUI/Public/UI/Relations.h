@@ -7,6 +7,13 @@
 class UGObject;
 class FByteBuffer;
 
+//one relation target as stored in the package, -1 means the parent
+struct FRelationRecord
+{
+    int16 TargetIndex;
+    TArray<TPair<ERelationType, bool>, TInlineAllocator<4>> Defs;
+};
+
 class FAIRYGUI_API FRelations
 {
 public:
@@ -23,10 +30,31 @@ public:
     void OnOwnerSizeChanged(const FVector2D& Delta, bool bApplyPivot);
     bool IsEmpty() const;
     void Setup(FByteBuffer* Buffer, bool bParentToChild);
+    void Setup(const TArray<FRelationRecord>& Records, bool bParentToChild);
+    static void Decode(FByteBuffer* Buffer, TArray<FRelationRecord>& OutRecords);
+
+    static void SolvePending();
 
     UGObject* Handling;
 
 private:
+    void MarkPending();
+    void Resolve();
+    bool IsEchoOf(UGObject* InTarget) const;
+
     UGObject* Owner;
     TIndirectArray<FRelationItem> Items;
+    uint8 bPending : 1;
+    uint8 bResolving : 1;
+    uint32 ResolvePass;
+    int32 ResolveCount;
+    //the target the owner last followed, and the pass it happened in
+    UGObject* AppliedFrom;
+    uint32 AppliedPass;
+
+    static TArray<TWeakObjectPtr<UGObject>> PendingOwners;
+    static uint32 CurrentPass;
+    static bool bSolving;
+
+    friend class FRelationItem;
 };
\ No newline at end of file
@@ -119,6 +119,12 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI")
     void CancelDragging();
 
+    UFUNCTION(BlueprintGetter, Category = "FairyGUI")
+    UGController* GetPageController() const { return PageController; }
+    //subscribes the owner to the controller, see UGController::AddSubscriber
+    UFUNCTION(BlueprintSetter, Category = "FairyGUI")
+    void SetPageController(UGController* InController);
+
     static UScrollPane* GetDraggingPane() { return DraggingPane.Get(); }
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
@@ -145,10 +151,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     float ScrollStep;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+private:
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintGetter = GetPageController, BlueprintSetter = SetPageController, Category = "FairyGUI", meta = (AllowPrivateAccess = "true"))
     UGController* PageController;
 
-private:
     void OnOwnerSizeChanged();
     void AdjustMaskContainer();
     void SetContentSize(const FVector2D& InSize);
@@ -75,4 +75,40 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     FString PopupMenuSeperator;
+
+    /** Seconds per frame that object pools may spend constructing pre-warmed instances. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    float PoolPrewarmFrameBudget;
+
+    /** Paint non-overlapping siblings on shared layers so Slate can batch their draws. Can also be enabled per component. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    bool LayerBatching;
+
+    /** Updates per second of tweens in the Background tick group. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    float TweenBackgroundTickRate;
+
+    /** Seconds per frame that a tween manager may spend on Background tweens, counted from the first one updated. The rest wait for the next frame and go first then. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    float TweenBackgroundFrameBudget;
+
+    /** Merge pointer moves of the same user and pointer within a frame and dispatch a single TouchMove with the latest position. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    bool CoalescePointerMoves;
+
+    /** Collect relation changes and solve them once per frame, targets before dependents, instead of on every position or size change. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    bool DeferRelations;
+
+    /** Memory in KB kept for shaped text layouts that text fields can share when they show the same text and format. 0 disables the cache. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    int32 TextLayoutCacheSize;
+
+    /** Sizes dynamic fonts are rendered at. Text between two sizes is rendered at the next larger one and scaled down, so tweened or geared sizes reuse the same glyphs. Empty renders every size as is. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    TArray<int32> FontSizeBuckets;
+
+    /** Font sizes of the default font whose glyphs are rendered for all strings of a package when it is added. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
+    TArray<int32> PrewarmFontSizes;
 };
\ No newline at end of file
@@ -8,7 +8,10 @@
 class FPackageItem;
 class UGObject;
 class FByteBuffer;
+class FByteBufferStringTable;
 class UUIPackageAsset;
+struct FUIPackageIndex;
+struct FStreamableHandle;
 
 USTRUCT(BlueprintType)
 struct FUIPackageDependency
@@ -22,6 +25,16 @@ struct FUIPackageDependency
     FString Name;
 };
 
+struct FUIPackageLoadTimes
+{
+    /** Seconds spent parsing the package index on a worker thread. */
+    double ParseSeconds = 0;
+    /** Seconds spent streaming the package asset and its textures/sounds. */
+    double StreamSeconds = 0;
+};
+
+DECLARE_DELEGATE_TwoParams(FOnUIPackageLoaded, UUIPackage*, const FUIPackageLoadTimes&);
+
 UCLASS(BlueprintType)
 class FAIRYGUI_API UUIPackage : public UObject
 {
@@ -46,6 +59,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "FairyGUI", meta = (WorldContext = "WorldContextObject"))
     static UUIPackage* AddPackage(class UUIPackageAsset* InAsset);
 
+    /**
+     * Parses the package index on a worker thread, streams the atlases and sounds it references,
+     * then registers the package on the game thread and fires OnLoaded (nullptr on failure).
+     */
+    static void AddPackageAsync(UUIPackageAsset* InAsset, FOnUIPackageLoaded OnLoaded);
+    static void AddPackageByPathAsync(const FString& InAssetPath, FOnUIPackageLoaded OnLoaded);
+
     UFUNCTION(BlueprintCallable, Category = "FairyGUI", meta = (WorldContext = "WorldContextObject"))
     static void RemovePackage(const FString& IDOrName);
 
@@ -102,7 +122,14 @@ public:
     UGObject* CreateObject(const FString& ResourceName, UObject* WorldContextObject);
     UGObject* CreateObject(const TSharedPtr<FPackageItem>& Item, UObject* WorldContextObject);
 
+    /** Renders the glyphs of every character in the package's strings for a dynamic font at a size, so text using them doesn't rasterize while it is shown. An empty face is the default font. */
+    UFUNCTION(BlueprintCallable, Category = "FairyGUI")
+    void PrewarmGlyphs(const FString& FontFace, int32 FontSize);
+
 private:
+    static void Register(UUIPackage* Pkg);
+    static void ParseIndex(FByteBuffer* Buffer, const FString& InAssetPath, FUIPackageIndex& OutIndex);
+    void ApplyIndex(FUIPackageIndex& Index);
     void Load(FByteBuffer* Buffer);
     void LoadAtlas(const TSharedPtr<FPackageItem>& Item);
     void LoadImage(const TSharedPtr<FPackageItem>& Item);
@@ -123,8 +150,10 @@ private:
     TArray<FString> Branches;
     int32 BranchIndex;
     TArray<FUIPackageDependency> Dependencies;
+    TSharedPtr<FByteBufferStringTable> StringTable;
     UPROPERTY(Transient)
     UUIPackageAsset* Asset;
+    TSharedPtr<FStreamableHandle> StreamingHandle;
 
     friend class FPackageItem;
     friend class UFairyApplication;
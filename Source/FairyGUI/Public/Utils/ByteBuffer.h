@@ -3,6 +3,40 @@
 #include "CoreMinimal.h"
 #include "FairyCommons.h"
 
+/**
+ * String table of a package. Entries stay as UTF-8 slices of the package data and are
+ * converted to FString only the first time they are read.
+ * IDs are read as FString too: they end up as keys of the FString maps of the package and
+ * in the FString IDs of items, objects and controller pages, and interning them as FName
+ * would grow the global name table for good and compare them case-insensitively.
+ */
+class FAIRYGUI_API FByteBufferStringTable
+{
+public:
+    FByteBufferStringTable(const uint8* InData, int32 InCount);
+
+    int32 Num() const { return Entries.Num(); }
+    void Add(int32 InOffset, int32 InLength);
+
+    const FString& Get(int32 Index);
+    //raw bytes of the package data, only for entries that were not decoded, which includes every entry replaced by Set
+    FUtf8StringView GetView(int32 Index) const;
+    bool IsDecoded(int32 Index) const { return Decoded[Index]; }
+    void Set(int32 Index, const FString& InString);
+
+private:
+    struct FEntry
+    {
+        int32 Offset;
+        int32 Length;
+    };
+
+    const uint8* Data;
+    TArray<FEntry> Entries;
+    TArray<FString> Strings;
+    TBitArray<> Decoded;
+};
+
 class FAIRYGUI_API FByteBuffer
 {
 public:
@@ -33,18 +67,19 @@ public:
     bool ReadS(FString& OutString);
     const FString* ReadSP();
     void WriteS(const FString& InString);
+    void ReadStringTable(int32 InCount);
     FColor ReadColor();
     TSharedPtr<FByteBuffer> ReadBuffer(bool bCloneBuffer);
     bool Seek(int32 IndexTablePos, int32 BlockIndex);
 
     bool bLittleEndian;
     int32 Version;
-    TSharedPtr<TArray<FString>> StringTable;
+    TSharedPtr<FByteBufferStringTable> StringTable;
 
 private:
     const uint8* Buffer;
     int32 Offset;
     int32 Length;
-    int32 Position;;
+    int32 Position;
     bool bOwnsBuffer;
 };
@@ -30,3 +30,23 @@ public:
     FVector2D Position;
     FXMLAttributes Attributes;
 };
+
+/**
+ * Elements parsed from one text. Reset only rewinds, the elements and their strings stay allocated
+ * so the next parse fills them again instead of allocating.
+ */
+class FAIRYGUI_API FHTMLElementArena
+{
+public:
+    FHTMLElement& Add(EHTMLElementType Type);
+    void Reset(int32 NewNum = 0) { check(NewNum <= NumElements); NumElements = NewNum; }
+
+    int32 Num() const { return NumElements; }
+    FHTMLElement& operator[](int32 Index) { check(Index < NumElements); return Elements[Index]; }
+    const FHTMLElement& operator[](int32 Index) const { check(Index < NumElements); return Elements[Index]; }
+    FHTMLElement& Last() { return (*this)[NumElements - 1]; }
+
+private:
+    TArray<FHTMLElement> Elements;
+    int32 NumElements = 0;
+};
@@ -19,7 +19,8 @@ public:
 
     FHTMLParser();
 
-    void Parse(const FString& InText, const FNTextFormat& InFormat, TArray<FHTMLElement>& OutElements, const FHTMLParseOptions& InParseOptions);
+    //elements are added after the ones already in OutElements and never merged into them
+    void Parse(const FString& InText, const FNTextFormat& InFormat, FHTMLElementArena& OutElements, const FHTMLParseOptions& InParseOptions);
 
 protected:
     void PushTextFormat();
@@ -33,6 +34,7 @@ protected:
     };
     TArray<FMyTextFormat> TextFormatStack;
     FMyTextFormat Format;
-    TArray<FHTMLElement>* Elements;
+    FHTMLElementArena* Elements;
+    int32 FirstElement;
     FHTMLParseOptions ParseOptions;
 };
\ No newline at end of file
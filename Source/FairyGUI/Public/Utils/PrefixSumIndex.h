@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fenwick tree over a sequence of non-negative extents. Gives O(log n) offset of an element,
+ * element at an offset and single-element updates.
+ */
+class FAIRYGUI_API FPrefixSumIndex
+{
+public:
+    FPrefixSumIndex();
+
+    int32 Num() const { return Values.Num(); }
+    void Reset() { Values.Reset(); Tree.Reset(); }
+
+    /** Rebuilds the index from InNum values in O(n). */
+    void Build(int32 InNum, TFunctionRef<double(int32)> GetValue);
+
+    double GetValue(int32 Index) const { return Values[Index]; }
+    void SetValue(int32 Index, double Value);
+
+    /** Sum of the first Count values, i.e. the offset of element Count. */
+    double GetPrefixSum(int32 Count) const;
+    double GetTotal() const { return GetPrefixSum(Values.Num()); }
+
+    /** Largest Count such that GetPrefixSum(Count) <= Offset, in [0, Num()]. */
+    int32 FindCount(double Offset) const;
+
+private:
+    TArray<double> Values;
+    TArray<double> Tree;
+    int32 HighBit;
+};
@@ -2,6 +2,7 @@
 
 #include "Slate.h"
 #include "Widgets/NTextFormat.h"
+#include "Utils/HTMLParser.h"
 
 DECLARE_DELEGATE_RetVal_ThreeParams(FString, FTagHandler, const FString&, bool, const FString&);
 DECLARE_DELEGATE_RetVal_FourParams(bool, FDefaultTagHandler, const FString&, bool, const FString&, FString&);
@@ -16,6 +17,11 @@ public:
 
     FString Parse(const FString& Text, bool bRemove = false);
 
+    //Tokenizes the text straight into elements, with the same result as Parse followed by FHTMLParser::Parse.
+    //Returns false without adding anything when the text needs that path: it contains html markup or
+    //entities, or tags are handled by a DefaultTagHandler or by handlers replaced in Handlers.
+    bool ParseElements(FStringView Text, const FNTextFormat& InFormat, FHTMLElementArena& OutElements, const FHTMLParseOptions& InParseOptions);
+
     int32 DefaultImgWidth;
     int32 DefaultImgHeight;
     FString LastColor;
@@ -33,7 +39,10 @@ protected:
     virtual FString OnTag_ALIGN(const FString& TagName, bool bEnd, const FString& Attr);
 
     FString GetTagText(bool bRemove);
+    FString GetTagText(FStringView Text, bool bRemove);
+    bool HasCustomHandlers() const;
 
     const FString* Source;
     int32 ReadPos;
+    TMap<FString, FDelegateHandle> NativeHandlers;
 };
\ No newline at end of file
@@ -9,6 +9,7 @@ class FSlateWindowElementList;
 struct FTextBlockStyle;
 enum class ETextHitPoint : uint8;
 
+/** A range of text drawn with a bitmap font, all glyphs of a block are painted as one batch. */
 class FAIRYGUI_API FBitmapFontRun : public ISlateRun, public TSharedFromThis< FBitmapFontRun >
 {
 public:
@@ -59,10 +60,19 @@ protected:
     FBitmapFontRun(const TSharedRef< const FString >& InText, const TSharedRef<FBitmapFont>& InFont, const FTextRange& InRange);
 
 private:
+    void UpdateGlyphs();
+    float MeasureWidth(int32 BeginIndex, int32 EndIndex) const;
+
     TSharedRef< const FString > Text;
     FTextRange Range;
 
     TSharedRef<FBitmapFont> Font;
-    FBitmapFont::FGlyph* Glyph;
+    //glyph of each character in Range, null for characters the font doesn't have
+    TArray<const FBitmapFont::FGlyph*> Glyphs;
+    float MaxLineHeight;
     FSlateBrush Brush;
+    FSlateResourceHandle ResourceHandle;
+
+    mutable TArray<FSlateVertex> Vertices;
+    mutable TArray<SlateIndex> Triangles;
 };
\ No newline at end of file
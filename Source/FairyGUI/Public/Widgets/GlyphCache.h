@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+
+/**
+ * Keeps dynamic font glyphs of FairyGUI text reusable. Sizes are quantized to FUIConfig::FontSizeBuckets,
+ * glyphs can be rendered ahead of time, and first uses of a glyph at a size are counted as cache misses.
+ * Glyphs rendered by other Slate text are not seen here, so the miss count is an upper bound.
+ */
+class FAIRYGUI_API FGlyphCache
+{
+public:
+    //The size a font of InSize is rendered at, InSize itself when no bucket covers it.
+    static int32 QuantizeFontSize(int32 InSize);
+
+    static void Prewarm(const FSlateFontInfo& InFont, FStringView InCharacters, float InScale = 1);
+    static void TrackGlyphs(const FSlateFontInfo& InFont, FStringView InText, float InScale);
+    static void Empty();
+
+private:
+    static TSet<TCHAR>& GetGlyphs(const FSlateFontInfo& InFont, float InScale);
+
+    static TMap<FSlateFontInfo, TSet<TCHAR>> RenderedGlyphs;
+};
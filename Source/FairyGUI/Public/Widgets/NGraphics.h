@@ -4,12 +4,17 @@
 #include "NTexture.h"
 #include "UI/FieldTypes.h"
 
+class SWidget;
+
 class FAIRYGUI_API FNGraphics : public FGCObject
 {
 public:
     FNGraphics();
     virtual ~FNGraphics();
 
+    //the widget painting this graphics, repainted whenever the mesh changes
+    void SetOwner(SWidget* InOwner) { Owner = InOwner; }
+
     const FColor& GetColor() const { return Color; }
     void SetColor(const FColor& InColor);
 
@@ -18,12 +23,13 @@ public:
 
     void SetTexture(UNTexture* InTexture);
     UNTexture* GetTexture() const { return Texture; }
+    const FSlateResourceHandle& GetResourceHandle() const { return ResourceHandle; }
 
     void SetMeshFactory(const TSharedPtr<IMeshFactory>& InMeshFactory);
     const TSharedPtr<IMeshFactory>& GetMeshFactory() { return MeshFactory; }
     template <typename T> T& GetMeshFactory();
 
-    void SetMeshDirty() { bMeshDirty = true; }
+    void SetMeshDirty();
 
     void Paint(const FGeometry& AllottedGeometry,
         FSlateWindowElementList& OutDrawElements,
@@ -39,7 +45,9 @@ public:
 
 private:
     void UpdateMeshNow();
+    void UpdatePositions(const FSlateRenderTransform& Transform, bool bMatrixChanged);
 
+    SWidget* Owner;
     FVector2D Size;
     FColor Color;
     EFlipType Flip;
@@ -51,10 +59,14 @@ private:
 
     TArray<FSlateVertex> Vertices;
     TArray<SlateIndex> Triangles;
-    TArray<FVector2D> PositionsBackup;
+    TArray<FVector2f> PositionsBackup;
+    //PositionsBackup with the linear part of PaintTransform applied, a moved but otherwise unchanged transform only adds the translation
+    TArray<FVector2f> LinearPositions;
     TArray<float> AlphaBackup;
     float UsingAlpha;
+    FSlateRenderTransform PaintTransform;
     bool bMeshDirty;
+    bool bPositionsDirty;
 };
 
 template <typename T>
@@ -11,6 +11,7 @@ struct FAIRYGUI_API FNTextFormat
 public:
     FNTextFormat();
     bool EqualStyle(const FNTextFormat& AnotherFormat) const;
+    bool operator==(const FNTextFormat& AnotherFormat) const;
     FTextBlockStyle GetStyle() const;
 
 public:
@@ -55,4 +56,5 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FairyGUI")
     FVector2D ShadowOffset;
-};
\ No newline at end of file
+};
+FAIRYGUI_API uint32 GetTypeHash(const FNTextFormat& Format);
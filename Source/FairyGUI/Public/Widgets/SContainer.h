@@ -24,11 +24,35 @@ public:
     void RemoveChildren(int32 BeginIndex = 0, int32 EndIndex = -1);
     int32 NumChildren() const;
 
+    void SetLayerBatching(bool bInLayerBatching);
+    bool IsLayerBatching() const { return bLayerBatching; }
+
 public:
     virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
     virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
     virtual FChildren* GetChildren() override;
+    virtual FSlateRect GetLocalPaintBounds() const override;
+
+protected:
+    virtual void OnChildPaintBoundsChanged() override;
+
+    void UpdateChildBounds() const;
+    FSlateRect GetChildLocalBounds(const TSharedRef<SWidget>& Child) const;
+    void ArrangeVisibleChildren(const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FArrangedChildren& ArrangedChildren) const;
 
 protected:
     TSlotlessChildren<SWidget> Children;
+    bool bLayerBatching;
+
+    struct FChildBounds
+    {
+        FSlateRect Rect;
+        int32 Index;
+    };
+    //local bounds of the children, sorted by top edge in large containers so painting only visits what is in view
+    mutable TArray<FChildBounds> ChildBounds;
+    //the largest bottom edge among each entry of ChildBounds and the entries before it
+    mutable TArray<float> ChildBoundsMaxBottom;
+    mutable FSlateRect ContentBounds;
+    mutable bool bChildBoundsDirty;
 };
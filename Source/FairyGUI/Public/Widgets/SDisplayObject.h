@@ -5,6 +5,7 @@
 #include "Slate.h"
 
 class UGObject;
+class FNGraphics;
 
 class FAIRYGUI_API SDisplayObject : public SWidget
 {
@@ -45,6 +46,15 @@ public:
 
     void UpdateVisibilityFlags();
 
+    //the single mesh this object draws, if any, siblings drawing with the same resource may share a layer
+    virtual const FNGraphics* GetGraphics() const { return nullptr; }
+    //the rectangle this object draws into in its own space, content that overflows makes it larger than Size
+    virtual FSlateRect GetLocalPaintBounds() const { return FSlateRect(FVector2D::ZeroVector, Size); }
+    //the absolute rectangle this object covers when painted with the given geometry
+    FSlateRect GetPaintBounds(const FGeometry& AllottedGeometry) const;
+    //tells the parent container the rectangle this object covers has changed
+    void InvalidatePaintBounds();
+
     virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
     virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
     virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
@@ -61,6 +71,9 @@ public:
     static void GetWidgetDescendants(const TSharedRef<SWidget>& InWidget, TArray<UGObject*>& OutArray);
     static void GetWidgetPathToRoot(const TSharedRef<SWidget>& InWidget, TArray<UGObject*>& OutArray);
 
+    //bumped whenever a display object or a GObject changes parent, cached paths to the root are dropped then
+    static uint32 HierarchyRevision;
+
 protected:
     virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
     virtual FChildren* GetChildren() override;
@@ -69,6 +82,8 @@ protected:
 
     EVisibility GetVisibilityFlags() const;
 
+    virtual void OnChildPaintBoundsChanged() {}
+
 protected:
     uint8 bVisible : 1;
     uint8 bInteractable : 1;
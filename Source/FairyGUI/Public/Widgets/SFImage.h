@@ -43,6 +43,7 @@ public:
 	// SWidget overrides
 	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
     virtual void OnPopulateMesh(FVertexHelper& Helper) override;
+    virtual const FNGraphics* GetGraphics() const override { return &Graphics; }
 
 protected:
     void TileFill(FVertexHelper& Helper, const FBox2D& ContentRect, const FBox2D& UVRect, const FVector2D& TextureSize);
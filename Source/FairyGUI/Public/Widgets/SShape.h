@@ -22,5 +22,6 @@ public:
 
 	// SWidget overrides
 	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+    virtual const FNGraphics* GetGraphics() const override { return &Graphics; }
 
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "UI/FieldTypes.h"
 #include "NTextFormat.h"
 #include "Utils/HTMLElement.h"
+#include "TextLayoutCache.h"
 
 class FSlateTextLayout;
 class FSlateTextUnderlineLineHighlighter;
@@ -21,7 +22,9 @@ public:
     void Construct(const FArguments& InArgs);
 
     const FString& GetText() const { return Text; }
-    void SetText(const FString& InText, bool bInHTML = false);
+    void SetText(const FString& InText, bool bInHTML = false, bool bInUBB = false);
+    //Adds a line at the end, only the new line is parsed and added to the current layout.
+    void AppendLine(const FString& InLine, bool bInHTML = false, bool bInUBB = false);
 
     EAutoSizeType GetAutoSize() const { return AutoSize; };
     void SetAutoSize(EAutoSizeType InAutoSize);
@@ -39,23 +42,35 @@ public:
 
     virtual FChildren* GetChildren() override;
     virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
+    virtual FSlateRect GetLocalPaintBounds() const override;
 
 protected:
     virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
     virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
-    virtual bool ComputeVolatility() const override { return true; }
     void UpdateTextLayout();
 
-    void BuildLines();
+    TSharedRef<FSlateTextLayout> CreateTextLayout();
+    bool OwnsTextLayout() const;
+    FGeometry GetTextGeometry(const FGeometry& AllottedGeometry) const;
+    void ParseText(const FString& InText);
+    void BuildLines(int32 FirstElement);
+    bool CanScaleElements(int32 FirstElement) const;
+    void OnTextLayoutUpdated();
 
 protected:
     FString Text;
     bool bHTML;
+    bool bUBB;
     EAutoSizeType AutoSize;
     bool bSingleLine;
     float MaxWidth;
     FNTextFormat TextFormat;
 
     TSharedRef<FSlateTextLayout> TextLayout;
-    TArray<FHTMLElement> HTMLElements;
+    //set while TextLayout is a finished layout that can be handed to the shared cache
+    TOptional<FTextLayoutKey> LayoutKey;
+    bool bLayoutDirty;
+    //size / rendered size of a quantized dynamic font, the layout is in rendered units
+    float FontScale;
+    FHTMLElementArena HTMLElements;
 };
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UI/FieldTypes.h"
+#include "NTextFormat.h"
+
+class FSlateTextLayout;
+
+struct FAIRYGUI_API FTextLayoutKey
+{
+    FString Text;
+    FNTextFormat Format;
+    uint32 FormatHash;
+    float WrappingWidth;
+    float Scale;
+    EAutoSizeType AutoSize;
+    bool bHTML;
+    bool bUBB;
+    bool bSingleLine;
+
+    FTextLayoutKey(const FString& InText, const FNTextFormat& InFormat, float InWrappingWidth, float InScale, EAutoSizeType InAutoSize, bool bInHTML, bool bInUBB, bool bInSingleLine);
+
+    bool operator==(const FTextLayoutKey& Other) const;
+    friend uint32 GetTypeHash(const FTextLayoutKey& Key);
+};
+
+/**
+ * Keeps shaped text layouts that no text field is using anymore, so a field that shows the same text
+ * with the same format and wrapping can take one over instead of parsing and shaping again.
+ * Entries are evicted least recently used first once the memory cap in FUIConfig is exceeded.
+ */
+class FAIRYGUI_API FTextLayoutCache
+{
+public:
+    static FTextLayoutCache& Get();
+
+    ~FTextLayoutCache();
+
+    TSharedPtr<FSlateTextLayout> Checkout(const FTextLayoutKey& Key);
+    void Return(const FTextLayoutKey& Key, const TSharedRef<FSlateTextLayout>& Layout);
+    void Empty();
+
+    int32 GetNum() const { return Entries.Num(); }
+    int64 GetMemorySize() const { return MemorySize; }
+    uint32 GetHitCount() const { return HitCount; }
+    uint32 GetMissCount() const { return MissCount; }
+
+private:
+    struct FEntry
+    {
+        FTextLayoutKey Key;
+        TSharedRef<FSlateTextLayout> Layout;
+        int32 Cost;
+    };
+    typedef TDoubleLinkedList<FEntry>::TDoubleLinkedListNode FEntryNode;
+
+    void RemoveNode(FEntryNode* Node);
+
+    //head is the most recently returned layout
+    TDoubleLinkedList<FEntry> Entries;
+    TMultiMap<FTextLayoutKey, FEntryNode*> Index;
+    int64 MemorySize = 0;
+    uint32 HitCount = 0;
+    uint32 MissCount = 0;
+};